@@ -0,0 +1,33 @@
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "impl/os_rng.h"
+#include "scalar/scalar.h"
+
+#include "bench_util.h"
+
+#include "polynomial/division.h"
+
+/**
+ * Measures the long and Newton divisions of a dividend of 2 * size coefficients by a divisor of size coefficients, so
+ * that the divisor and the quotient have the same size, up to max_size, from which
+ * <tt>polynomial::LONG_DIVISION_MAX_SIZE</tt> is chosen.
+ * Usage: KZG_BENCH_DIVISION [max_size]
+ */
+int main(int argc, char *argv[]) {
+    const size_t max_size = argc > 1 ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 2048;
+    rng::impl::OsRng rng;
+
+    std::cout << std::setw(10) << "size" << std::setw(14) << "long" << std::setw(14) << "newton"
+              << "  (us per division)" << std::endl;
+    for (size_t size = 16; size <= max_size; size += size / 2) {
+        const auto a = random_coefficients(2 * size, rng);
+        const auto b = random_coefficients(size, rng);
+        std::cout << std::setw(10) << size << std::fixed << std::setprecision(1)
+                  << std::setw(14) << measure(kzg::polynomial::long_divide, a, b)
+                  << std::setw(14) << measure(kzg::polynomial::newton_divide, a, b) << std::endl;
+    }
+    return 0;
+}
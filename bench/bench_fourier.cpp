@@ -0,0 +1,66 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "impl/os_rng.h"
+#include "scalar/scalar.h"
+
+#include "domain/domain.h"
+#include "domain/fourier.h"
+#include "utils/parallel.h"
+
+using bls12_381::scalar::Scalar;
+using kzg::domain::EvaluationDomain;
+
+/// Returns the median of the wall-clock times of <tt>runs</tt> forward FFTs of <tt>input</tt>, in milliseconds.
+double median_transform_time(const EvaluationDomain &domain, const std::vector<Scalar> &input, size_t runs) {
+    std::vector<double> times;
+    times.reserve(runs);
+    for (size_t run = 0; run < runs; ++run) {
+        auto values = input;
+        const auto start = std::chrono::steady_clock::now();
+        domain.fast_fourier_in_place(values);
+        const auto end = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    std::nth_element(times.begin(), times.begin() + static_cast<long>(runs / 2), times.end());
+    return times[runs / 2];
+}
+
+/**
+ * Measures the forward FFT over domains of 2 ^ (PARALLEL_FOURIER_MIN_LOG_SIZE - 2) up to 2 ^ max_log_size elements
+ * with 1 to 64 threads, reporting the median of the given number of runs after one warmup transform. The warmup
+ * builds the twiddle table and starts the workers of the thread pool, so neither is part of the timing.
+ * Usage: KZG_BENCH_FOURIER [max_log_size] [runs]
+ */
+int main(int argc, char *argv[]) {
+    const uint32_t max_log_size = argc > 1 ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 20;
+    const size_t runs = std::max<size_t>(argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 7, 1);
+    const std::vector<size_t> thread_counts = {1, 2, 4, 8, 16, 32, 64};
+
+    rng::impl::OsRng rng;
+    std::cout << std::setw(10) << "log_size";
+    for (const size_t threads: thread_counts) std::cout << std::setw(12) << threads;
+    std::cout << "  (median ms per transform over " << runs << " runs / threads)" << std::endl;
+
+    for (uint32_t log_size = kzg::domain::PARALLEL_FOURIER_MIN_LOG_SIZE - 2; log_size <= max_log_size; ++log_size) {
+        const EvaluationDomain domain{static_cast<uint64_t>(1) << log_size};
+        std::vector<Scalar> input;
+        input.reserve(domain.size());
+        for (size_t i = 0; i < domain.size(); ++i) input.push_back(Scalar::random(rng));
+
+        std::cout << std::setw(10) << log_size;
+        for (const size_t threads: thread_counts) {
+            const kzg::util::parallel::ScopedNumThreads scoped{threads};
+            auto warmup = input;
+            domain.fast_fourier_in_place(warmup);
+            const double elapsed = median_transform_time(domain, input, runs);
+            std::cout << std::setw(12) << std::fixed << std::setprecision(2) << elapsed;
+        }
+        std::cout << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,54 @@
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <span>
+#include <vector>
+
+#include "impl/os_rng.h"
+#include "scalar/scalar.h"
+
+#include "bench_util.h"
+
+#include "polynomial/multiplication.h"
+
+using bls12_381::scalar::Scalar;
+
+using Multiplier = std::function<std::vector<Scalar>(std::span<const Scalar>, std::span<const Scalar>)>;
+
+/**
+ * Measures the schoolbook, Karatsuba and FFT products of two operands of the same size, up to max_size coefficients,
+ * then the products of an operand of 4096 coefficients by shorter ones, from which the thresholds of
+ * <tt>polynomial::multiply</tt> are chosen.
+ * Usage: KZG_BENCH_MULTIPLICATION [max_size]
+ */
+int main(int argc, char *argv[]) {
+    const size_t max_size = argc > 1 ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 512;
+    rng::impl::OsRng rng;
+
+    std::cout << std::setw(10) << "size" << std::setw(14) << "schoolbook" << std::setw(14) << "karatsuba"
+              << std::setw(14) << "fourier" << "  (us per product)" << std::endl;
+    for (size_t size = 4; size <= max_size; size += size / 2) {
+        const auto a = random_coefficients(size, rng);
+        const auto b = random_coefficients(size, rng);
+        std::cout << std::setw(10) << size << std::fixed << std::setprecision(1)
+                  << std::setw(14) << measure(kzg::polynomial::schoolbook_multiply, a, b)
+                  << std::setw(14) << measure(kzg::polynomial::karatsuba_multiply, a, b)
+                  << std::setw(14) << measure(kzg::polynomial::fourier_multiply, a, b) << std::endl;
+    }
+
+    std::cout << std::endl << std::setw(10) << "small" << std::setw(14) << "balanced" << std::setw(14) << "unbalanced"
+              << "  (us per product with 4096 coefficients)" << std::endl;
+    const auto large = random_coefficients(4096, rng);
+    const Multiplier balanced = [](std::span<const Scalar> a, std::span<const Scalar> b) {
+        return b.size() <= kzg::polynomial::KARATSUBA_MULTIPLICATION_MAX_SIZE
+               ? kzg::polynomial::karatsuba_multiply(a, b) : kzg::polynomial::fourier_multiply(a, b);
+    };
+    for (size_t size = 32; size <= 2048; size *= 2) {
+        const auto small = random_coefficients(size, rng);
+        std::cout << std::setw(10) << size << std::fixed << std::setprecision(1)
+                  << std::setw(14) << measure(balanced, large, small)
+                  << std::setw(14) << measure(kzg::polynomial::unbalanced_multiply, large, small) << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,35 @@
+#ifndef KZG_COMMITMENT_BENCH_UTIL_H
+#define KZG_COMMITMENT_BENCH_UTIL_H
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+#include "impl/os_rng.h"
+#include "scalar/scalar.h"
+
+/// Measures the average time of an operation on two operands in microseconds, repeating it for at least 50 ms.
+template<typename Operation>
+double measure(const Operation &operation,
+               const std::vector<bls12_381::scalar::Scalar> &a,
+               const std::vector<bls12_381::scalar::Scalar> &b) {
+    size_t rounds = 0;
+    const auto start = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::micro> elapsed{0};
+    while (elapsed.count() < 50000) {
+        static_cast<void>(operation(a, b));
+        rounds++;
+        elapsed = std::chrono::steady_clock::now() - start;
+    }
+    return elapsed.count() / static_cast<double>(rounds);
+}
+
+/// Draws the given number of random coefficients.
+inline std::vector<bls12_381::scalar::Scalar> random_coefficients(size_t size, rng::impl::OsRng &rng) {
+    std::vector<bls12_381::scalar::Scalar> coefficients;
+    coefficients.reserve(size);
+    for (size_t i = 0; i < size; ++i) coefficients.push_back(bls12_381::scalar::Scalar::random(rng));
+    return coefficients;
+}
+
+#endif //KZG_COMMITMENT_BENCH_UTIL_H
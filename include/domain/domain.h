@@ -2,6 +2,7 @@
 #define KZG_COMMITMENT_DOMAIN_H
 
 #include <cstdint>
+#include <memory>
 #include <vector>
 #include <optional>
 
@@ -10,13 +11,15 @@
 #include "domain/fourier.h"
 
 namespace kzg::polynomial { class EvaluationForm; }
-namespace kzg::domain { class ElementIterator; }
+namespace kzg::domain { class ElementIterator; class ElementRange; struct TwiddleCache; }
 
 namespace kzg::domain {
 
 /**
  * @brief Defines a domain over which finite field FFTs can be efficiently performed.
- *          Works only for fields which have a large multiplicative subgroup of size which is a power of 2.
+ *          Works only for fields which have a large multiplicative subgroup of size which is a power of 2. Domains of
+ *          size 3 * 2 ^ k are also supported through <tt>mixed_radix</tt>, since the multiplicative group of the
+ *          BLS12-381 scalar field has a factor of 3.
  */
 class EvaluationDomain {
 public:
@@ -27,6 +30,12 @@ private:
     bls12_381::scalar::Scalar group_gen;
     /// the size of the domain
     uint64_t domain_size;
+    /// inverse of the size of the domain, cached at construction
+    bls12_381::scalar::Scalar size_inv;
+    /// inverse of the generator of the subgroup, cached at construction
+    bls12_381::scalar::Scalar group_gen_inv;
+    /// twiddle tables of both directions, built on first use and shared by the copies and moved-from sources of this domain
+    std::shared_ptr<TwiddleCache> twiddle_cache;
 
 public:
     EvaluationDomain();
@@ -35,9 +44,20 @@ public:
     explicit EvaluationDomain(uint64_t num_of_coefficients);
     EvaluationDomain(bls12_381::scalar::Scalar generator, uint64_t size);
 
+    /**
+     * @brief Constructs the smallest domain of size 2 ^ k or 3 * 2 ^ k holding the given number of coefficients.
+     * @param num_of_coefficients the minimum size of the domain.
+     * @return the domain.
+     * @exception INVALID_EVALUATION_DOMAIN_SIZE the domain size is too large.
+     */
+    static auto mixed_radix(uint64_t num_of_coefficients) -> EvaluationDomain;
+
     [[nodiscard]] auto size() const noexcept -> size_t;
 
-    /// Log of the size of the domain.
+    /// Whether the size of the domain is a power of 2, rather than 3 times a power of 2.
+    [[nodiscard]] auto is_radix_2() const noexcept -> bool;
+
+    /// Log of the size of the domain, or of its largest subgroup of power of 2 size for a mixed-radix domain.
     [[nodiscard]] auto log_size() const noexcept -> size_t;
     /// Size of the domain (as a field element).
     [[nodiscard]] auto size_as_field_element() const -> bls12_381::scalar::Scalar;
@@ -48,8 +68,24 @@ public:
     /// Inverse of the generator of the subgroup.
     [[nodiscard]] auto group_generator_inverse() const -> bls12_381::scalar::Scalar;
 
+    /**
+     * @brief Gets the twiddle factors of the forward FFT over this domain, see <tt>compute_twiddles</tt>.
+     * @details The table is built on the first call and shared with every copy of this domain. For a mixed-radix
+     *          domain, this is the table of its subgroup of size n / 3.
+     */
+    [[nodiscard]] auto twiddles() const -> const std::vector<bls12_381::scalar::Scalar> &;
+    /// Gets the twiddle factors of the inverse FFT over this domain, built on the first call.
+    [[nodiscard]] auto inverse_twiddles() const -> const std::vector<bls12_381::scalar::Scalar> &;
+
     [[nodiscard]] auto iter() const -> ElementIterator;
 
+    /**
+     * @brief Gets the elements of this domain as a random-access range over the table of the powers of its generator.
+     * @details The table is built on the first call, split among the threads of <tt>util::parallel</tt>, and shared
+     *          with every copy of this domain.
+     */
+    [[nodiscard]] auto elements() const -> ElementRange;
+
     [[nodiscard]] auto fast_fourier(std::vector<bls12_381::scalar::Scalar> &coefficients) const -> std::vector<bls12_381::scalar::Scalar>;
     [[nodiscard]] auto inverse_fast_fourier(std::vector<bls12_381::scalar::Scalar> &evaluations) const -> std::vector<bls12_381::scalar::Scalar>;
     [[nodiscard]] auto coset_fast_fourier(std::vector<bls12_381::scalar::Scalar> &coefficients) const -> std::vector<bls12_381::scalar::Scalar>;
@@ -60,6 +96,84 @@ public:
     void coset_fast_fourier_in_place(std::vector<bls12_381::scalar::Scalar> &coefficients) const;
     void coset_inverse_fast_fourier_in_place(std::vector<bls12_381::scalar::Scalar> &evaluations) const;
 
+    /**
+     * @brief Evaluates the polynomial over the coset <tt>shift</tt> * H of this domain H.
+     * @param coefficients the coefficients, of at most the size of the domain, replaced by the evaluations.
+     * @param shift the coset shift, must be non-zero.
+     */
+    void coset_fast_fourier_in_place(std::vector<bls12_381::scalar::Scalar> &coefficients,
+                                     const bls12_381::scalar::Scalar &shift) const;
+
+    /**
+     * @brief Interpolates the polynomial from its evaluations over the coset <tt>shift</tt> * H of this domain H.
+     * @param evaluations the evaluations, replaced by the coefficients.
+     * @param shift the coset shift, must be non-zero.
+     */
+    void coset_inverse_fast_fourier_in_place(std::vector<bls12_381::scalar::Scalar> &evaluations,
+                                             const bls12_381::scalar::Scalar &shift) const;
+
+    /**
+     * @brief Evaluates several polynomials over this domain at once.
+     * @details The columns are processed in groups, each group interleaved so that its butterflies share their
+     *          twiddle loads, and the groups are split among the threads of <tt>util::parallel</tt>.
+     * @param columns the coefficients of the polynomials, each padded with zeros to the size of the domain and
+     *          replaced by its evaluations.
+     */
+    void fast_fourier_batch_in_place(std::vector<std::vector<bls12_381::scalar::Scalar>> &columns) const;
+
+    /**
+     * @brief Interpolates several polynomials from their evaluations over this domain at once.
+     * @param columns the evaluations of the polynomials, each replaced by its coefficients.
+     */
+    void inverse_fast_fourier_batch_in_place(std::vector<std::vector<bls12_381::scalar::Scalar>> &columns) const;
+
+    /**
+     * @brief Evaluates the polynomial over this domain, leaving the evaluations in bit-reversed order.
+     * @details Skips the bit-reversal permutation, for pipelines such as convolutions that never expose the order of
+     *          the evaluations and come back with <tt>inverse_fast_fourier_bit_reversed_in_place</tt>.
+     * @param coefficients the coefficients in natural order, padded with zeros to the size of the domain.
+     * @exception INVALID_EVALUATION_DOMAIN_SIZE the domain is not of power of 2 size.
+     */
+    void fast_fourier_bit_reversed_in_place(std::vector<bls12_381::scalar::Scalar> &coefficients) const;
+
+    /**
+     * @brief Interpolates the polynomial from its evaluations given in bit-reversed order, without permutation.
+     * @param evaluations the evaluations in bit-reversed order, replaced by the coefficients in natural order.
+     * @exception INVALID_EVALUATION_DOMAIN_SIZE the domain is not of power of 2 size.
+     */
+    void inverse_fast_fourier_bit_reversed_in_place(std::vector<bls12_381::scalar::Scalar> &evaluations) const;
+
+    /**
+     * @brief Evaluates the polynomial over this domain, computing only the first evaluations in natural order.
+     * @details Skips the butterflies whose inputs are known to be zero past the given coefficients, and those which
+     *          only feed the evaluations past <tt>output_length</tt>.
+     * @param coefficients the coefficients, of at most the size of the domain, replaced by the first
+     *          <tt>output_length</tt> evaluations.
+     * @param output_length the number of evaluations to be computed, at most the size of the domain.
+     */
+    void fast_fourier_pruned_in_place(std::vector<bls12_381::scalar::Scalar> &coefficients,
+                                      size_t output_length) const;
+
+    /**
+     * @brief Evaluates the polynomial over this domain in bit-reversed order, as
+     *          <tt>fast_fourier_bit_reversed_in_place</tt>, skipping the butterflies whose inputs are known to be zero
+     *          past the given coefficients.
+     * @param coefficients the coefficients in natural order, of at most the size of the domain.
+     * @exception INVALID_EVALUATION_DOMAIN_SIZE the domain is not of power of 2 size.
+     */
+    void fast_fourier_bit_reversed_pruned_in_place(std::vector<bls12_381::scalar::Scalar> &coefficients) const;
+
+    /**
+     * @brief Interpolates the polynomial from its evaluations given in bit-reversed order, as
+     *          <tt>inverse_fast_fourier_bit_reversed_in_place</tt>, computing only its first coefficients.
+     * @param evaluations the evaluations in bit-reversed order, replaced by the first <tt>output_length</tt>
+     *          coefficients.
+     * @param output_length the number of coefficients to be computed, at most the size of the domain.
+     * @exception INVALID_EVALUATION_DOMAIN_SIZE the domain is not of power of 2 size.
+     */
+    void inverse_fast_fourier_bit_reversed_pruned_in_place(std::vector<bls12_381::scalar::Scalar> &evaluations,
+                                                           size_t output_length) const;
+
     /**
      * @brief Evaluates the vanishing polynomial defined by this domain at a given point.
      * @details For a multiplicative subgroup, the vanishing polynomial should be in the form of z(X) = X ^ size - 1.
@@ -0,0 +1,86 @@
+#ifndef KZG_COMMITMENT_EXTENSION_H
+#define KZG_COMMITMENT_EXTENSION_H
+
+#include <cstdint>
+#include <vector>
+
+#include "scalar/scalar.h"
+
+#include "domain/domain.h"
+
+namespace kzg::domain {
+
+/**
+ * @brief Builds the domain H' of size n * blowup, which contains the domain H of size n.
+ * @param domain the base domain H.
+ * @param blowup the ratio of the sizes of the domains, must be a power of two.
+ * @return the extended domain H'.
+ * @exception INVALID_EVALUATION_DOMAIN_SIZE the blowup factor is not a power of two, or the extension is too large.
+ */
+auto extended_domain(const EvaluationDomain &domain, size_t blowup) -> EvaluationDomain;
+
+/**
+ * @brief Computes the shifts of the cosets covered by a low degree extension.
+ * @details With H of size n and the subgroup H' of size n * blowup generated by zeta, the cosets are
+ *          offset * zeta ^ i * H for i in [0, blowup), whose union is the coset offset * H'.
+ * @param domain the base domain H.
+ * @param blowup the number of cosets, must be a power of two.
+ * @param offset the shift of the extended coset, an offset inside H' giving H' itself.
+ * @return the shifts of the cosets.
+ * @exception INVALID_EVALUATION_DOMAIN_SIZE the blowup factor is not a power of two, or the extension is too large.
+ */
+auto extension_shifts(
+        const EvaluationDomain &domain,
+        size_t blowup,
+        const bls12_381::scalar::Scalar &offset
+) -> std::vector<bls12_381::scalar::Scalar>;
+
+/**
+ * @brief Evaluates a polynomial over several cosets of a domain, with arbitrary shifts.
+ * @details Coefficients beyond the size of the domain are folded onto it after scaling, so polynomials of any degree
+ *          are supported. The per-coset transforms are split among the threads of <tt>util::parallel</tt>.
+ * @param domain the domain H.
+ * @param coefficients the coefficients of the polynomial.
+ * @param shifts the coset shifts.
+ * @return the evaluations over each coset shift * H, in the order of <tt>shifts</tt>.
+ */
+auto evaluate_over_cosets(
+        const EvaluationDomain &domain,
+        const std::vector<bls12_381::scalar::Scalar> &coefficients,
+        const std::vector<bls12_381::scalar::Scalar> &shifts
+) -> std::vector<std::vector<bls12_381::scalar::Scalar>>;
+
+/**
+ * @brief Computes the low degree extension of a polynomial over <tt>blowup</tt> cosets of a domain.
+ * @param domain the base domain H.
+ * @param coefficients the coefficients of the polynomial, of degree less than the size of H times <tt>blowup</tt>.
+ * @param blowup the number of cosets, must be a power of two.
+ * @param offset the shift of the extended coset, see <tt>extension_shifts</tt>.
+ * @return the evaluations over each coset of <tt>extension_shifts(domain, blowup, offset)</tt>.
+ * @exception POLY_DEGREE_TOO_LARGE the polynomial does not fit in the extension.
+ */
+auto low_degree_extension(
+        const EvaluationDomain &domain,
+        const std::vector<bls12_381::scalar::Scalar> &coefficients,
+        size_t blowup,
+        const bls12_381::scalar::Scalar &offset
+) -> std::vector<std::vector<bls12_381::scalar::Scalar>>;
+
+/**
+ * @brief Brings the evaluations of a low degree extension back to the coefficients of the polynomial.
+ * @details The cosets are interleaved into the extended coset offset * H' and interpolated with a single transform.
+ * @param domain the base domain H.
+ * @param evaluations the evaluations over each coset, as produced by <tt>low_degree_extension</tt>.
+ * @param offset the shift of the extended coset.
+ * @return the coefficients, of size n * blowup.
+ * @exception SIZE_MISMATCH the cosets do not all have the size of the domain.
+ */
+auto inverse_low_degree_extension(
+        const EvaluationDomain &domain,
+        const std::vector<std::vector<bls12_381::scalar::Scalar>> &evaluations,
+        const bls12_381::scalar::Scalar &offset
+) -> std::vector<bls12_381::scalar::Scalar>;
+
+} // namespace kzg::domain
+
+#endif //KZG_COMMITMENT_EXTENSION_H
@@ -8,8 +8,26 @@
 
 namespace kzg::domain {
 
+/**
+ * Transforms of at least 2 ^ PARALLEL_FOURIER_MIN_LOG_SIZE elements are dispatched to the parallel FFT. This is a
+ * conservative default rather than a measured crossover: it has only been checked on a single-core host, so run
+ * KZG_BENCH_FOURIER on the target machine before relying on it.
+ */
+constexpr uint32_t PARALLEL_FOURIER_MIN_LOG_SIZE = 14;
+/**
+ * Multi-threaded transforms of at least 2 ^ SIX_STEP_FOURIER_MIN_LOG_SIZE elements, which exceed the L2 cache, use the
+ * six-step FFT. On a single core it is 1% to 26% slower than the serial kernel from 2 ^ 14 up to 2 ^ 20, so it is only
+ * chosen when more than one thread is configured.
+ */
+constexpr uint32_t SIX_STEP_FOURIER_MIN_LOG_SIZE = 16;
+
+/**
+ * @brief Multiplies the i-th coefficient by generator ^ i, so that the polynomial p(X) becomes p(generator * X).
+ * @param coefficients the coefficients to be scaled in place.
+ * @param generator the scaling factor.
+ */
 void distribute_powers(
-        const std::vector<bls12_381::scalar::Scalar> &coefficients,
+        std::vector<bls12_381::scalar::Scalar> &coefficients,
         const bls12_381::scalar::Scalar &generator
 );
 
@@ -19,6 +37,184 @@ void serial_fast_fourier(
         uint32_t log_size
 );
 
+/**
+ * @brief Computes the twiddle factors of a radix-2 FFT of size 2 ^ log_size, laid out stage by stage.
+ * @details The twiddles of the stage merging blocks of size m are stored contiguously at [m - 1, 2m - 1), and the
+ *          j-th of them is omega ^ (j * n / 2m). The table holds n - 1 elements in total.
+ * @param omega the primitive n-th root of unity.
+ * @param log_size log of the transform size.
+ * @return the twiddle table.
+ */
+auto compute_twiddles(const bls12_381::scalar::Scalar &omega, uint32_t log_size) -> std::vector<bls12_381::scalar::Scalar>;
+
+/**
+ * @brief Performs an in-place FFT reading its twiddle factors from a precomputed table.
+ * @details Two radix-2 stages are merged into one radix-4 pass whenever possible, halving the passes over memory.
+ * @param a the vector to be transformed, of size 2 ^ log_size.
+ * @param twiddles the table produced by <tt>compute_twiddles</tt> for the same size.
+ * @param log_size log of the transform size.
+ */
+void serial_fast_fourier(
+        std::vector<bls12_381::scalar::Scalar> &a,
+        const std::vector<bls12_381::scalar::Scalar> &twiddles,
+        uint32_t log_size
+);
+
+/**
+ * @brief Performs an in-place radix-2 FFT using the worker threads of <tt>util::parallel</tt>.
+ * @details The bit-reversal permutation is split among the threads. The first stages run on independent blocks, one
+ *          per thread, and the last log(threads) stages split the butterflies of each stage among the threads.
+ * @param a the vector to be transformed, of size 2 ^ log_size.
+ * @param twiddles the table produced by <tt>compute_twiddles</tt> for the same size.
+ * @param log_size log of the transform size.
+ */
+void parallel_fast_fourier(
+        std::vector<bls12_381::scalar::Scalar> &a,
+        const std::vector<bls12_381::scalar::Scalar> &twiddles,
+        uint32_t log_size
+);
+
+/**
+ * @brief Performs an in-place decimation-in-frequency FFT, taking its input in natural order and leaving its output in
+ *          bit-reversed order, without any permutation.
+ * @param a the vector to be transformed, of size 2 ^ log_size.
+ * @param twiddles the table produced by <tt>compute_twiddles</tt> for the same size.
+ * @param log_size log of the transform size.
+ */
+void decimation_in_frequency_fast_fourier(
+        std::vector<bls12_381::scalar::Scalar> &a,
+        const std::vector<bls12_381::scalar::Scalar> &twiddles,
+        uint32_t log_size
+);
+
+/**
+ * @brief Performs an in-place decimation-in-time FFT, taking its input in bit-reversed order and leaving its output in
+ *          natural order, without any permutation. Inverts <tt>decimation_in_frequency_fast_fourier</tt> when given the
+ *          inverse twiddles, up to the scaling by 1 / n.
+ * @param a the vector to be transformed, of size 2 ^ log_size.
+ * @param twiddles the table produced by <tt>compute_twiddles</tt> for the same size.
+ * @param log_size log of the transform size.
+ */
+void decimation_in_time_fast_fourier(
+        std::vector<bls12_381::scalar::Scalar> &a,
+        const std::vector<bls12_381::scalar::Scalar> &twiddles,
+        uint32_t log_size
+);
+
+/**
+ * @brief Performs an in-place decimation-in-frequency FFT of an input whose entries from <tt>input_length</tt> on are
+ *          zero, leaving its output in bit-reversed order.
+ * @details When the input fits in 2 ^ (log_size - s) entries, the first s stages only copy and scale it. The input is
+ *          then directly spread into 2 ^ s blocks, the r-th one scaled by the powers of omega ^ bitrev(r), which are
+ *          transformed independently.
+ * @param a the vector to be transformed, of size 2 ^ log_size.
+ * @param input_length the number of leading entries which may be non-zero.
+ * @param twiddles the table produced by <tt>compute_twiddles</tt> for the same size.
+ * @param log_size log of the transform size.
+ */
+void pruned_decimation_in_frequency_fast_fourier(
+        std::vector<bls12_381::scalar::Scalar> &a,
+        size_t input_length,
+        const std::vector<bls12_381::scalar::Scalar> &twiddles,
+        uint32_t log_size
+);
+
+/**
+ * @brief Performs a decimation-in-time FFT of an input in bit-reversed order, computing only the first
+ *          <tt>output_length</tt> entries of its output in natural order.
+ * @details When the output fits in 2 ^ (log_size - s) entries, the last s stages are replaced by a direct combination
+ *          of the 2 ^ s transformed blocks for the needed entries only.
+ * @param a the vector to be transformed, of size 2 ^ log_size, resized to output_length.
+ * @param output_length the number of leading entries of the output to be computed.
+ * @param twiddles the table produced by <tt>compute_twiddles</tt> for the same size.
+ * @param log_size log of the transform size.
+ */
+void pruned_decimation_in_time_fast_fourier(
+        std::vector<bls12_381::scalar::Scalar> &a,
+        size_t output_length,
+        const std::vector<bls12_381::scalar::Scalar> &twiddles,
+        uint32_t log_size
+);
+
+/**
+ * @brief Performs an FFT of an input whose entries from <tt>input_length</tt> on are zero, computing only the first
+ *          <tt>output_length</tt> entries of its output, both in natural order.
+ * @details A short output is computed from the transforms of the 2 ^ s strided sub-sequences of the input, otherwise
+ *          the input pruning of <tt>pruned_decimation_in_frequency_fast_fourier</tt> applies.
+ * @param a the vector to be transformed, of size 2 ^ log_size, resized to output_length.
+ * @param input_length the number of leading entries which may be non-zero.
+ * @param output_length the number of leading entries of the output to be computed.
+ * @param twiddles the table produced by <tt>compute_twiddles</tt> for the same size.
+ * @param log_size log of the transform size.
+ */
+void pruned_fast_fourier(
+        std::vector<bls12_381::scalar::Scalar> &a,
+        size_t input_length,
+        size_t output_length,
+        const std::vector<bls12_381::scalar::Scalar> &twiddles,
+        uint32_t log_size
+);
+
+/**
+ * @brief Performs an in-place FFT as a matrix of about sqrt(n) x sqrt(n) elements, following the six-step algorithm:
+ *          transpose, transform the rows, multiply by twiddles, transpose, transform the rows, transpose.
+ * @details Every sub-transform works on a contiguous row that fits in cache, instead of striding across the whole
+ *          vector in the last stages. The rows are split among the threads of <tt>util::parallel</tt>. The twiddles of
+ *          the sub-transforms are prefixes of the table of the full transform. The scratch buffer of n elements is
+ *          taken from <tt>util::workspace</tt>, and the old storage of <tt>a</tt> is recycled in its place.
+ * @param a the vector to be transformed, of size 2 ^ log_size.
+ * @param twiddles the table produced by <tt>compute_twiddles</tt> for the same size.
+ * @param log_size log of the transform size.
+ */
+void six_step_fast_fourier(
+        std::vector<bls12_381::scalar::Scalar> &a,
+        const std::vector<bls12_381::scalar::Scalar> &twiddles,
+        uint32_t log_size
+);
+
+/**
+ * @brief Performs in place the FFTs of <tt>width</tt> vectors stored interleaved, the i-th element of the c-th vector
+ *          being at <tt>i * width + c</tt>.
+ * @details Each twiddle factor is loaded once and applied to the butterflies of all the vectors, which run back to
+ *          back on contiguous memory.
+ * @param a the interleaved vectors, of size width * 2 ^ log_size.
+ * @param width the number of vectors.
+ * @param twiddles the table produced by <tt>compute_twiddles</tt> for the transform size.
+ * @param log_size log of the transform size.
+ */
+void batch_fast_fourier(
+        std::vector<bls12_381::scalar::Scalar> &a,
+        size_t width,
+        const std::vector<bls12_381::scalar::Scalar> &twiddles,
+        uint32_t log_size
+);
+
+/**
+ * @brief Performs an in-place FFT of size 3 * 2 ^ log_size, splitting the input into three interleaved parts of size
+ *          2 ^ log_size, transforming each of them and merging them with radix-3 butterflies.
+ * @param a the vector to be transformed, of size 3 * 2 ^ log_size.
+ * @param omega the primitive root of unity of order 3 * 2 ^ log_size.
+ * @param twiddles the table produced by <tt>compute_twiddles</tt> for omega ^ 3 and log_size.
+ * @param log_size log of the size of each part.
+ */
+void radix_3_fast_fourier(
+        std::vector<bls12_381::scalar::Scalar> &a,
+        const bls12_381::scalar::Scalar &omega,
+        const std::vector<bls12_381::scalar::Scalar> &twiddles,
+        uint32_t log_size
+);
+
+/**
+ * @brief Performs an in-place FFT. With a single thread, the serial kernel is always used. Otherwise transforms of at
+ *          least 2 ^ SIX_STEP_FOURIER_MIN_LOG_SIZE elements use the six-step kernel, and transforms of at least
+ *          2 ^ PARALLEL_FOURIER_MIN_LOG_SIZE elements the parallel kernel.
+ */
+void best_fast_fourier(
+        std::vector<bls12_381::scalar::Scalar> &a,
+        const std::vector<bls12_381::scalar::Scalar> &twiddles,
+        uint32_t log_size
+);
+
 } // namespace kzg::domain
 
 #endif //KZG_COMMITMENT_FOURIER_H
@@ -4,7 +4,9 @@
 #include <cassert>
 #include <cstdint>
 #include <iterator>
+#include <memory>
 #include <optional>
+#include <vector>
 
 #include "scalar/scalar.h"
 
@@ -62,6 +64,58 @@ public:
     }
 };
 
+/**
+ * @brief Represents a contiguous range of the elements of a domain, backed by the shared table of its powers.
+ * @details The iterators are random-access, so that the range can be handed to the parallel algorithms of the
+ *          standard library, and the range can be split into sub-ranges for <tt>util::parallel</tt>.
+ */
+class ElementRange {
+private:
+    /// The powers of the generator of the domain, shared by all the ranges over it.
+    std::shared_ptr<const std::vector<bls12_381::scalar::Scalar>> powers;
+
+    size_t first;
+    size_t last;
+
+public:
+    using iterator = std::vector<bls12_381::scalar::Scalar>::const_iterator;
+    using const_iterator = iterator;
+    using value_type = bls12_381::scalar::Scalar;
+
+public:
+    ElementRange() = delete;
+    explicit ElementRange(std::shared_ptr<const std::vector<bls12_381::scalar::Scalar>> powers);
+    ElementRange(std::shared_ptr<const std::vector<bls12_381::scalar::Scalar>> powers, size_t first, size_t last);
+
+public:
+    [[nodiscard]] auto size() const noexcept -> size_t;
+    [[nodiscard]] auto empty() const noexcept -> bool;
+
+    /// Index in the domain of the first element of this range.
+    [[nodiscard]] auto offset() const noexcept -> size_t;
+
+    [[nodiscard]] auto begin() const -> iterator;
+    [[nodiscard]] auto end() const -> iterator;
+
+    /**
+     * @brief Gets a sub-range of this range.
+     * @param begin index of the first element, relative to this range.
+     * @param end index past the last element, relative to this range.
+     * @return the sub-range.
+     */
+    [[nodiscard]] auto subrange(size_t begin, size_t end) const -> ElementRange;
+
+    /**
+     * @brief Splits this range into contiguous sub-ranges of nearly equal sizes.
+     * @param parts the number of sub-ranges, at least 1.
+     * @return the sub-ranges, fewer than <tt>parts</tt> if the range is too short.
+     */
+    [[nodiscard]] auto split(size_t parts) const -> std::vector<ElementRange>;
+
+public:
+    const bls12_381::scalar::Scalar &operator[](size_t index) const;
+};
+
 } // namespace kzg::domain
 
 #endif //KZG_COMMITMENT_ITERATOR_H
\ No newline at end of file
@@ -0,0 +1,77 @@
+#ifndef KZG_COMMITMENT_QUOTIENT_H
+#define KZG_COMMITMENT_QUOTIENT_H
+
+#include <utility>
+#include <vector>
+
+#include "scalar/scalar.h"
+
+#include "domain/domain.h"
+
+namespace kzg::domain {
+
+/**
+ * @brief Divides a polynomial by the vanishing polynomial Z(X) = X ^ n - 1 of a domain, in time linear in its degree.
+ * @details Since X ^ n = 1 modulo Z, the quotient satisfies q[i] = p[i + n] + q[i + n]. It is computed from the top,
+ *          one row of n coefficients at a time, each row being split among the threads of <tt>util::parallel</tt>.
+ * @param domain the domain H of size n.
+ * @param coefficients the coefficients of the dividend p.
+ * @return the quotient and the remainder, the remainder having n coefficients.
+ */
+auto divide_by_vanishing_polynomial(
+        const EvaluationDomain &domain,
+        const std::vector<bls12_381::scalar::Scalar> &coefficients
+) -> std::pair<std::vector<bls12_381::scalar::Scalar>, std::vector<bls12_381::scalar::Scalar>>;
+
+/**
+ * @brief Computes the inverses of the vanishing polynomial of a domain over the coset of another domain.
+ * @details Z(shift * zeta ^ i) = shift ^ n * zeta ^ (n * i) - 1 only takes N / gcd(N, n) distinct values, which are
+ *          computed and inverted together.
+ * @param domain the domain H of size n, defining the vanishing polynomial.
+ * @param coset_domain the domain H' of size N, generated by zeta.
+ * @param shift the shift of the coset shift * H'.
+ * @return one period of the inverses, the i-th element of the coset using the entry i modulo the period.
+ * @exception DIVISION_BY_ZERO the vanishing polynomial has a root on the coset.
+ */
+auto vanishing_polynomial_inverses_over_coset(
+        const EvaluationDomain &domain,
+        const EvaluationDomain &coset_domain,
+        const bls12_381::scalar::Scalar &shift
+) -> std::vector<bls12_381::scalar::Scalar>;
+
+/**
+ * @brief Divides the evaluations of a polynomial over the coset shift * H' by those of the vanishing polynomial of H.
+ * @param domain the domain H, defining the vanishing polynomial.
+ * @param coset_domain the domain H'.
+ * @param evaluations the evaluations over shift * H', replaced by the evaluations of the quotient.
+ * @param shift the shift of the coset.
+ * @exception SIZE_MISMATCH the evaluations do not match the size of H'.
+ * @exception DIVISION_BY_ZERO the vanishing polynomial has a root on the coset.
+ */
+void divide_by_vanishing_polynomial_over_coset(
+        const EvaluationDomain &domain,
+        const EvaluationDomain &coset_domain,
+        std::vector<bls12_381::scalar::Scalar> &evaluations,
+        const bls12_381::scalar::Scalar &shift
+);
+
+/**
+ * @brief Computes the quotient t(X) = p(X) / Z(X) of a polynomial divisible by the vanishing polynomial of a domain.
+ * @details p is evaluated over a coset shift * H' where H' is just large enough to hold t, divided pointwise and
+ *          interpolated back. The result is only meaningful when the division is exact, otherwise use
+ *          <tt>divide_by_vanishing_polynomial</tt>.
+ * @param domain the domain H, defining the vanishing polynomial.
+ * @param coefficients the coefficients of the dividend p.
+ * @param shift the shift of the coset, which must not meet H.
+ * @return the coefficients of the quotient.
+ * @exception DIVISION_BY_ZERO the vanishing polynomial has a root on the coset.
+ */
+auto quotient_over_coset(
+        const EvaluationDomain &domain,
+        const std::vector<bls12_381::scalar::Scalar> &coefficients,
+        const bls12_381::scalar::Scalar &shift
+) -> std::vector<bls12_381::scalar::Scalar>;
+
+} // namespace kzg::domain
+
+#endif //KZG_COMMITMENT_QUOTIENT_H
@@ -15,6 +15,7 @@ enum class Type {
     CIRCUIT_DEGREE_IS_ZERO,
     SIZE_MISMATCH,
     SERIALIZE_NO_ENOUGH_BYTES,
+    DIVISION_BY_ZERO,
 };
 
 class Exception: public std::exception {
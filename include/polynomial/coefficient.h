@@ -1,6 +1,9 @@
 #ifndef KZG_COMMITMENT_COEFFICIENT_H
 #define KZG_COMMITMENT_COEFFICIENT_H
 
+#include <optional>
+#include <span>
+#include <utility>
 #include <vector>
 
 #include "core/rng.h"
@@ -38,12 +41,60 @@ public:
      * @return the quotient polynomial.
      */
     [[nodiscard]] auto ruffini(const bls12_381::scalar::Scalar &point) const -> CoefficientForm;
+
+    /**
+     * @brief Divides the polynomial by another one, with long division for short divisors or quotients, and with
+     *          Newton inversion of the reversed divisor otherwise.
+     * @param divisor the polynomial to divide by.
+     * @return the quotient and the remainder polynomials.
+     * @exception DIVISION_BY_ZERO the divisor is zero.
+     */
+    [[nodiscard]] auto divide_with_remainder(const CoefficientForm &divisor) const
+    -> std::pair<CoefficientForm, CoefficientForm>;
+
+    /**
+     * @brief Evaluates the polynomial at a point with Horner's rule, without allocating.
+     * @details Small polynomials, or any polynomial with a single thread, are evaluated inline. Large polynomials are
+     *          split into one chunk per thread, each chunk is evaluated with Horner's rule and scaled by the power of the
+     *          point at its offset, and the partial sums are kept in a workspace buffer until they are added up.
+     * @param point the point to evaluate at.
+     * @return the evaluation result.
+     */
     [[nodiscard]] auto evaluate(const bls12_381::scalar::Scalar &point) const -> bls12_381::scalar::Scalar;
-    [[nodiscard]] auto get_coefficients() const -> std::vector<bls12_381::scalar::Scalar>;
 
-    static std::optional<CoefficientForm> from_slice(const std::vector<uint8_t> &bytes);
+    /**
+     * @brief Evaluates the polynomial at several points with Horner's rule, in a single pass over the coefficients.
+     * @details Each coefficient is read once for all the points, which suits a few points. The subproduct tree is
+     *          faster for many points. Each chunk of coefficients writes its partial sums to its own row of a single
+     *          buffer, and the rows are added up after the threads join.
+     * @param points the points to evaluate at.
+     * @return the evaluation results, in the order of <tt>points</tt>.
+     */
+    [[nodiscard]] auto evaluate(std::span<const bls12_381::scalar::Scalar> points) const
+    -> std::vector<bls12_381::scalar::Scalar>;
+
+    [[nodiscard]] auto get_coefficients() const -> const std::vector<bls12_381::scalar::Scalar> &;
+
+    /**
+     * @brief Moves the coefficients out of the polynomial, which becomes the zero polynomial, so that their storage can
+     *          be given back to <tt>util::workspace</tt>.
+     * @return the coefficients.
+     */
+    [[nodiscard]] auto take_coefficients() -> std::vector<bls12_381::scalar::Scalar>;
+
+    static std::optional<CoefficientForm> from_slice(std::span<const uint8_t> bytes);
     [[nodiscard]] std::vector<uint8_t> to_var_bytes() const;
 
+    /// Size of the serialized polynomial in bytes.
+    [[nodiscard]] auto var_bytes_size() const -> size_t;
+
+    /**
+     * @brief Serializes the polynomial in place into a caller-provided buffer.
+     * @param buffer the buffer to write to, of at least <tt>var_bytes_size()</tt> bytes.
+     * @exception SERIALIZE_NO_ENOUGH_BYTES the buffer is too small.
+     */
+    void write_var_bytes(std::span<uint8_t> buffer) const;
+
 public:
     CoefficientForm &operator=(const CoefficientForm &rhs);
     CoefficientForm &operator=(CoefficientForm &&rhs) noexcept;
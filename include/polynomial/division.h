@@ -0,0 +1,65 @@
+#ifndef KZG_COMMITMENT_DIVISION_H
+#define KZG_COMMITMENT_DIVISION_H
+
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "scalar/scalar.h"
+
+namespace kzg::polynomial {
+
+/// Divisions whose divisor or quotient has at most this many coefficients use long division.
+constexpr size_t LONG_DIVISION_MAX_SIZE = 256;
+
+/**
+ * @brief Computes the inverse of a power series modulo X ^ precision by Newton iteration, g <- g - g * (f * g - 1),
+ *          which doubles the number of correct coefficients at each step.
+ * @param f the coefficients of the series, whose constant term must be non-zero.
+ * @param precision the number of coefficients of the inverse.
+ * @return the coefficients of the inverse, of size <tt>precision</tt>.
+ */
+auto inverse_series(
+        std::span<const bls12_381::scalar::Scalar> f,
+        size_t precision
+) -> std::vector<bls12_381::scalar::Scalar>;
+
+/**
+ * @brief Divides two polynomials with schoolbook long division, in O((n - m) * m).
+ * @param a the coefficients of the dividend.
+ * @param b the coefficients of the divisor, whose leading coefficient must be non-zero.
+ * @return the coefficients of the quotient and of the remainder, the remainder having m - 1 coefficients.
+ */
+auto long_divide(
+        std::span<const bls12_381::scalar::Scalar> a,
+        std::span<const bls12_381::scalar::Scalar> b
+) -> std::pair<std::vector<bls12_381::scalar::Scalar>, std::vector<bls12_381::scalar::Scalar>>;
+
+/**
+ * @brief Divides two polynomials through the reversed polynomials, in O(n log n).
+ * @details With k = n - m + 1, rev(q) = rev(a) * rev(b) ^ -1 modulo X ^ k, the inverse being computed by
+ *          <tt>inverse_series</tt>, and the remainder is a - q * b. All the products use <tt>multiply</tt>.
+ * @param a the coefficients of the dividend.
+ * @param b the coefficients of the divisor, whose leading coefficient must be non-zero.
+ * @return the coefficients of the quotient and of the remainder, the remainder having m - 1 coefficients.
+ */
+auto newton_divide(
+        std::span<const bls12_381::scalar::Scalar> a,
+        std::span<const bls12_381::scalar::Scalar> b
+) -> std::pair<std::vector<bls12_381::scalar::Scalar>, std::vector<bls12_381::scalar::Scalar>>;
+
+/**
+ * @brief Divides two polynomials, using long division when the divisor or the quotient is short.
+ * @param a the coefficients of the dividend.
+ * @param b the coefficients of the divisor, whose leading coefficient must be non-zero.
+ * @return the coefficients of the quotient and of the remainder.
+ */
+auto divide(
+        std::span<const bls12_381::scalar::Scalar> a,
+        std::span<const bls12_381::scalar::Scalar> b
+) -> std::pair<std::vector<bls12_381::scalar::Scalar>, std::vector<bls12_381::scalar::Scalar>>;
+
+} // namespace kzg::polynomial
+
+#endif //KZG_COMMITMENT_DIVISION_H
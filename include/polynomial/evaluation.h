@@ -1,6 +1,8 @@
 #ifndef KZG_COMMITMENT_EVALUATION_H
 #define KZG_COMMITMENT_EVALUATION_H
 
+#include <optional>
+#include <span>
 #include <vector>
 
 #include "scalar/scalar.h"
@@ -19,6 +21,8 @@ private:
     std::vector<bls12_381::scalar::Scalar> evaluations;
     /// The evaluation domain of the polynomial.
     domain::EvaluationDomain domain;
+    /// An upper bound of the degree of the polynomial, unknown for evaluations built without one.
+    std::optional<size_t> degree_bound;
 
 public:
     EvaluationForm() = delete;
@@ -28,12 +32,68 @@ public:
     EvaluationForm(const std::vector<bls12_381::scalar::Scalar> &evaluations, const domain::EvaluationDomain &domain);
     EvaluationForm(std::vector<bls12_381::scalar::Scalar> &&evaluations, domain::EvaluationDomain &&domain);
 
+    /**
+     * @brief Builds a polynomial from its evaluations over a whole domain and an upper bound of its degree.
+     * @details The arithmetic of two polynomials with known degree bounds extends their domains whenever the result
+     *          would not fit, so chains of operations can stay in evaluation form. Without a known bound on either
+     *          side, the operations are plain pointwise ones over a shared domain.
+     * @exception SIZE_MISMATCH the evaluations do not cover the domain, or the bound does not fit in it.
+     */
+    EvaluationForm(std::vector<bls12_381::scalar::Scalar> &&evaluations, domain::EvaluationDomain &&domain,
+                   size_t degree_bound);
+
+    /**
+     * @brief Evaluates a polynomial over a domain, keeping its degree as the degree bound.
+     * @param polynomial the polynomial in coefficient form.
+     * @param domain the evaluation domain.
+     * @return the polynomial in evaluation form.
+     * @exception POLY_DEGREE_TOO_LARGE the polynomial has more coefficients than the size of the domain.
+     */
+    static EvaluationForm from_coefficients(const CoefficientForm &polynomial, const domain::EvaluationDomain &domain);
+
+    /**
+     * @brief Re-evaluates the polynomial over a domain <tt>blowup</tt> times larger which contains the current one.
+     * @details The current evaluations are kept, and the missing ones are those over the cosets zeta ^ i * H of the
+     *          domain H for i in [1, blowup), with zeta the generator of the larger domain.
+     * @param blowup the ratio of the sizes of the domains, must be a power of two.
+     * @return the polynomial over the larger domain, with the same degree bound.
+     * @exception SIZE_MISMATCH the evaluations do not cover the domain.
+     * @exception INVALID_EVALUATION_DOMAIN_SIZE the blowup factor is not a power of two.
+     */
+    [[nodiscard]] auto extend(size_t blowup) const -> EvaluationForm;
+
     /**
      * @brief Interpolates the polynomial from its evaluations.
      * @return the interpolated polynomial in coefficient form.
      */
     [[nodiscard]] CoefficientForm interpolate() const;
 
+    /**
+     * @brief Interpolates the polynomial into a caller-provided buffer, so that its storage is reused across calls.
+     * @param coefficients the buffer to write the coefficients to, resized to the size of the domain.
+     */
+    void interpolate_into(std::vector<bls12_381::scalar::Scalar> &coefficients) const;
+
+    /**
+     * @brief Evaluates the polynomial at a point with the barycentric formula,
+     *          f(z) = (z ^ n - 1) / n * sum_i f_i * omega ^ i / (z - omega ^ i).
+     * @details The sum is accumulated as a single fraction in one pass over the evaluations, so that it needs one
+     *          inversion and no temporary vector. The pass is split among the threads of <tt>util::parallel</tt>.
+     * @param point the point to evaluate at.
+     * @return the evaluation result.
+     */
+    [[nodiscard]] auto evaluate(const bls12_381::scalar::Scalar &point) const -> bls12_381::scalar::Scalar;
+
+    /**
+     * @brief Evaluates the polynomial at several points with the barycentric formula.
+     * @details The powers of the domain generator and the scaled evaluations are shared by all the points in a single
+     *          pass, and the final inversions are batched.
+     * @param points the points to evaluate at.
+     * @return the evaluation results, in the order of <tt>points</tt>.
+     */
+    [[nodiscard]] auto evaluate(std::span<const bls12_381::scalar::Scalar> points) const
+    -> std::vector<bls12_381::scalar::Scalar>;
+
 public:
     EvaluationForm &operator=(const EvaluationForm &rhs);
     EvaluationForm &operator=(EvaluationForm &&rhs) noexcept;
@@ -41,6 +101,12 @@ public:
     EvaluationForm &operator+=(const EvaluationForm &polynomial);
     EvaluationForm &operator-=(const EvaluationForm &polynomial);
     EvaluationForm &operator*=(const EvaluationForm &polynomial);
+
+    /**
+     * @brief Divides the evaluations pointwise, with a single batch inversion of the divisor. The degree bound of the
+     *          result is unknown.
+     * @exception DIVISION_BY_ZERO an evaluation of the divisor is zero.
+     */
     EvaluationForm &operator/=(const EvaluationForm &polynomial);
 
     bls12_381::scalar::Scalar &operator[](size_t index);
@@ -48,10 +114,28 @@ public:
 
     [[nodiscard]] const std::vector<bls12_381::scalar::Scalar> &get_evaluations() const;
     [[nodiscard]] const domain::EvaluationDomain &get_domain() const;
+    [[nodiscard]] auto get_degree_bound() const -> std::optional<size_t>;
 
-    static std::optional<EvaluationForm> from_slice(const std::vector<uint8_t> &bytes);
+    /**
+     * @brief Deserializes a polynomial written by <tt>to_var_bytes</tt>.
+     * @remark The degree bound is not part of the serialized form, so the result has no degree bound, and its
+     *          arithmetic falls back to the size of its domain.
+     * @param bytes the evaluations followed by the domain.
+     * @return the deserialized polynomial, or nothing if the bytes are malformed.
+     */
+    static std::optional<EvaluationForm> from_slice(std::span<const uint8_t> bytes);
     [[nodiscard]] std::vector<uint8_t> to_var_bytes() const;
 
+    /// Size of the serialized polynomial in bytes.
+    [[nodiscard]] auto var_bytes_size() const -> size_t;
+
+    /**
+     * @brief Serializes the polynomial together with its domain in place into a caller-provided buffer.
+     * @param buffer the buffer to write to, of at least <tt>var_bytes_size()</tt> bytes.
+     * @exception SERIALIZE_NO_ENOUGH_BYTES the buffer is too small.
+     */
+    void write_var_bytes(std::span<uint8_t> buffer) const;
+
 public:
     friend inline EvaluationForm operator+(const EvaluationForm &a, const EvaluationForm &b) { return EvaluationForm(a) += b; }
     friend inline EvaluationForm operator-(const EvaluationForm &a, const EvaluationForm &b) { return EvaluationForm(a) -= b; }
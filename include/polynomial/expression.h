@@ -0,0 +1,184 @@
+#ifndef KZG_COMMITMENT_EXPRESSION_H
+#define KZG_COMMITMENT_EXPRESSION_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "scalar/scalar.h"
+
+#include "polynomial/coefficient.h"
+#include "polynomial/evaluation.h"
+#include "utils/parallel.h"
+
+namespace kzg::polynomial {
+
+/// Fused loops over expressions of at least this many coefficients are split among the threads.
+constexpr size_t PARALLEL_EXPRESSION_MIN_SIZE = 4096;
+
+/**
+ * @brief Base of the lazy linear combinations of polynomials, which only record their operands and are computed
+ *          coefficient by coefficient in a single loop by <tt>evaluate</tt>.
+ * @details The expressions keep references to the polynomials they are built from, so they must be evaluated while
+ *          these polynomials are alive, typically in the same statement.
+ */
+template<typename E>
+struct Expression {
+    [[nodiscard]] const E &self() const { return static_cast<const E &>(*this); }
+};
+
+/// A polynomial used as a leaf of an expression, see <tt>lazy</tt>.
+template<typename Form>
+class Operand : public Expression<Operand<Form>> {
+private:
+    const Form &form;
+    size_t length;
+
+public:
+    using form_type = Form;
+
+    Operand(const Form &form, size_t length) : form{form}, length{length} {}
+
+    [[nodiscard]] size_t size() const { return this->length; }
+    [[nodiscard]] const Form &origin() const { return this->form; }
+    [[nodiscard]] bls12_381::scalar::Scalar operator[](size_t index) const {
+        return index < this->length ? this->form[index] : bls12_381::scalar::Scalar::zero();
+    }
+};
+
+template<typename L, typename R>
+class Sum : public Expression<Sum<L, R>> {
+private:
+    L left;
+    R right;
+
+public:
+    using form_type = typename L::form_type;
+    static_assert(std::is_same_v<form_type, typename R::form_type>, "operands are not in the same form.");
+
+    Sum(const L &left, const R &right) : left{left}, right{right} {
+        if constexpr (std::is_same_v<form_type, EvaluationForm>)
+            assert(left.origin().get_domain() == right.origin().get_domain());
+    }
+
+    [[nodiscard]] size_t size() const { return std::max(this->left.size(), this->right.size()); }
+    [[nodiscard]] const form_type &origin() const { return this->left.origin(); }
+    [[nodiscard]] bls12_381::scalar::Scalar operator[](size_t index) const {
+        return this->left[index] + this->right[index];
+    }
+};
+
+template<typename L, typename R>
+class Difference : public Expression<Difference<L, R>> {
+private:
+    L left;
+    R right;
+
+public:
+    using form_type = typename L::form_type;
+    static_assert(std::is_same_v<form_type, typename R::form_type>, "operands are not in the same form.");
+
+    Difference(const L &left, const R &right) : left{left}, right{right} {
+        if constexpr (std::is_same_v<form_type, EvaluationForm>)
+            assert(left.origin().get_domain() == right.origin().get_domain());
+    }
+
+    [[nodiscard]] size_t size() const { return std::max(this->left.size(), this->right.size()); }
+    [[nodiscard]] const form_type &origin() const { return this->left.origin(); }
+    [[nodiscard]] bls12_381::scalar::Scalar operator[](size_t index) const {
+        return this->left[index] - this->right[index];
+    }
+};
+
+template<typename E>
+class Scaled : public Expression<Scaled<E>> {
+private:
+    E inner;
+    bls12_381::scalar::Scalar factor;
+
+public:
+    using form_type = typename E::form_type;
+
+    Scaled(const E &inner, const bls12_381::scalar::Scalar &factor) : inner{inner}, factor{factor} {}
+
+    [[nodiscard]] size_t size() const { return this->inner.size(); }
+    [[nodiscard]] const form_type &origin() const { return this->inner.origin(); }
+    [[nodiscard]] bls12_381::scalar::Scalar operator[](size_t index) const { return this->inner[index] * this->factor; }
+};
+
+/// Wraps a polynomial in coefficient form into an expression operand.
+inline Operand<CoefficientForm> lazy(const CoefficientForm &polynomial) {
+    return {polynomial, polynomial.is_zero() ? 0 : polynomial.degree() + 1};
+}
+
+/// Wraps a polynomial in evaluation form into an expression operand.
+inline Operand<EvaluationForm> lazy(const EvaluationForm &polynomial) {
+    return {polynomial, polynomial.get_evaluations().size()};
+}
+
+template<typename L, typename R>
+Sum<L, R> operator+(const Expression<L> &left, const Expression<R> &right) {
+    return {left.self(), right.self()};
+}
+
+template<typename L, typename R>
+Difference<L, R> operator-(const Expression<L> &left, const Expression<R> &right) {
+    return {left.self(), right.self()};
+}
+
+template<typename E>
+Scaled<E> operator*(const Expression<E> &expression, const bls12_381::scalar::Scalar &factor) {
+    return {expression.self(), factor};
+}
+
+template<typename E>
+Scaled<E> operator*(const bls12_381::scalar::Scalar &factor, const Expression<E> &expression) {
+    return {expression.self(), factor};
+}
+
+template<typename E>
+Scaled<E> operator-(const Expression<E> &expression) {
+    return {expression.self(), -bls12_381::scalar::Scalar::one()};
+}
+
+/**
+ * @brief Computes an expression into a buffer, in a single loop split among the threads for large sizes.
+ * @param expression the expression to compute.
+ * @param destination the buffer, resized to the size of the expression.
+ */
+template<typename E>
+void evaluate_into(const Expression<E> &expression, std::vector<bls12_381::scalar::Scalar> &destination) {
+    const E &root = expression.self();
+    const size_t size = root.size();
+    destination.resize(size, bls12_381::scalar::Scalar::zero());
+    const auto compute = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) destination[i] = root[i];
+    };
+    if (size >= PARALLEL_EXPRESSION_MIN_SIZE)
+        util::parallel::parallel_for(size, compute, PARALLEL_EXPRESSION_MIN_SIZE / 4);
+    else
+        compute(0, size);
+}
+
+/// Computes an expression of polynomials in coefficient form.
+template<typename E> requires std::is_same_v<typename E::form_type, CoefficientForm>
+CoefficientForm evaluate(const Expression<E> &expression) {
+    std::vector<bls12_381::scalar::Scalar> coefficients;
+    evaluate_into(expression, coefficients);
+    return CoefficientForm{std::move(coefficients)};
+}
+
+/// Computes an expression of polynomials in evaluation form, which must all share the same domain.
+template<typename E> requires std::is_same_v<typename E::form_type, EvaluationForm>
+EvaluationForm evaluate(const Expression<E> &expression) {
+    std::vector<bls12_381::scalar::Scalar> evaluations;
+    evaluate_into(expression, evaluations);
+    return EvaluationForm{std::move(evaluations), domain::EvaluationDomain{expression.self().origin().get_domain()}};
+}
+
+} // namespace kzg::polynomial
+
+#endif //KZG_COMMITMENT_EXPRESSION_H
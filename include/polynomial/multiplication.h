@@ -0,0 +1,81 @@
+#ifndef KZG_COMMITMENT_MULTIPLICATION_H
+#define KZG_COMMITMENT_MULTIPLICATION_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "scalar/scalar.h"
+
+namespace kzg::polynomial {
+
+/// Products whose shorter operand has at most this many coefficients use the schoolbook method.
+constexpr size_t SCHOOLBOOK_MULTIPLICATION_MAX_SIZE = 24;
+/// Products whose shorter operand has at most this many coefficients use Karatsuba's method, larger ones use FFTs.
+constexpr size_t KARATSUBA_MULTIPLICATION_MAX_SIZE = 128;
+/// Products whose longer operand is at least this many times the shorter one are computed chunk by chunk.
+constexpr size_t UNBALANCED_MULTIPLICATION_RATIO = 4;
+
+/**
+ * @brief Multiplies two polynomials with the schoolbook method, in O(n * m).
+ * @param a the coefficients of the first polynomial.
+ * @param b the coefficients of the second polynomial.
+ * @return the coefficients of the product, of size n + m - 1, or empty if an operand is empty.
+ */
+auto schoolbook_multiply(
+        std::span<const bls12_381::scalar::Scalar> a,
+        std::span<const bls12_381::scalar::Scalar> b
+) -> std::vector<bls12_381::scalar::Scalar>;
+
+/**
+ * @brief Multiplies two polynomials with Karatsuba's method, in O(n ^ 1.59).
+ * @details The operands are split at half the length of the longer one, and the three sub-products go back through
+ *          <tt>multiply</tt>, so that small or unbalanced ones use the appropriate method.
+ * @param a the coefficients of the first polynomial.
+ * @param b the coefficients of the second polynomial.
+ * @return the coefficients of the product, of size n + m - 1, or empty if an operand is empty.
+ */
+auto karatsuba_multiply(
+        std::span<const bls12_381::scalar::Scalar> a,
+        std::span<const bls12_381::scalar::Scalar> b
+) -> std::vector<bls12_381::scalar::Scalar>;
+
+/**
+ * @brief Multiplies two polynomials through their evaluations over a domain of size at least n + m - 1.
+ * @param a the coefficients of the first polynomial.
+ * @param b the coefficients of the second polynomial.
+ * @return the coefficients of the product, of size n + m - 1, or empty if an operand is empty.
+ */
+auto fourier_multiply(
+        std::span<const bls12_381::scalar::Scalar> a,
+        std::span<const bls12_381::scalar::Scalar> b
+) -> std::vector<bls12_381::scalar::Scalar>;
+
+/**
+ * @brief Multiplies a long polynomial by a short one, chunk by chunk of the long operand.
+ * @details Above the Karatsuba range, the short operand is transformed once and its evaluations are reused for all
+ *          the chunks, each chunk filling a domain of about twice the size of the short operand.
+ * @param large the coefficients of the long polynomial.
+ * @param small the coefficients of the short polynomial.
+ * @return the coefficients of the product, of size n + m - 1, or empty if an operand is empty.
+ */
+auto unbalanced_multiply(
+        std::span<const bls12_381::scalar::Scalar> large,
+        std::span<const bls12_381::scalar::Scalar> small
+) -> std::vector<bls12_381::scalar::Scalar>;
+
+/**
+ * @brief Multiplies two polynomials, choosing the method from the sizes of the operands.
+ * @details The thresholds were measured with the <tt>KZG_BENCH_MULTIPLICATION</tt> benchmark.
+ * @param a the coefficients of the first polynomial.
+ * @param b the coefficients of the second polynomial.
+ * @return the coefficients of the product, of size n + m - 1, or empty if an operand is empty.
+ */
+auto multiply(
+        std::span<const bls12_381::scalar::Scalar> a,
+        std::span<const bls12_381::scalar::Scalar> b
+) -> std::vector<bls12_381::scalar::Scalar>;
+
+} // namespace kzg::polynomial
+
+#endif //KZG_COMMITMENT_MULTIPLICATION_H
@@ -0,0 +1,111 @@
+#ifndef KZG_COMMITMENT_SPARSE_H
+#define KZG_COMMITMENT_SPARSE_H
+
+#include <utility>
+#include <vector>
+
+#include "scalar/scalar.h"
+
+#include "polynomial/coefficient.h"
+
+namespace kzg::polynomial {
+
+/**
+ * @brief Represents a polynomial in coefficient form by its non-zero terms only, such as the vanishing polynomial
+ *          X ^ n - 1 of a domain or its multiples.
+ * @details The arithmetic with a dense polynomial costs the number of terms times the size of the dense one, which
+ *          beats the transforms of <tt>CoefficientForm</tt> for a few terms.
+ */
+class SparseCoefficientForm {
+private:
+    /// The non-zero terms as (degree, coefficient) pairs, sorted by increasing degree.
+    std::vector<std::pair<size_t, bls12_381::scalar::Scalar>> terms;
+
+public:
+    SparseCoefficientForm();
+
+    /**
+     * @brief Builds a polynomial from terms in any order, terms of a same degree are summed and zeros are dropped.
+     * @param terms the (degree, coefficient) pairs.
+     */
+    explicit SparseCoefficientForm(std::vector<std::pair<size_t, bls12_381::scalar::Scalar>> terms);
+
+    static SparseCoefficientForm zero();
+
+    /// The vanishing polynomial X ^ n - 1 of a domain of size n.
+    static SparseCoefficientForm vanishing_polynomial(size_t size);
+
+    static SparseCoefficientForm from_dense(const CoefficientForm &polynomial);
+    [[nodiscard]] auto to_dense() const -> CoefficientForm;
+
+    [[nodiscard]] auto is_zero() const -> bool;
+    [[nodiscard]] auto degree() const -> size_t;
+    [[nodiscard]] auto get_terms() const -> const std::vector<std::pair<size_t, bls12_381::scalar::Scalar>> &;
+
+    /**
+     * @brief Evaluates the polynomial at a point, with one exponentiation by the gap between consecutive terms.
+     * @param point the point to evaluate at.
+     * @return the evaluation result.
+     */
+    [[nodiscard]] auto evaluate(const bls12_381::scalar::Scalar &point) const -> bls12_381::scalar::Scalar;
+
+    /**
+     * @brief Divides the polynomial by (X - point) using Ruffini's method, skipping over the missing terms.
+     * @details The quotient of a sparse polynomial by (X - point) is dense in general, it is built directly without
+     *          densifying the polynomial first.
+     * @param point the point to divide by.
+     * @return the quotient polynomial.
+     */
+    [[nodiscard]] auto ruffini(const bls12_381::scalar::Scalar &point) const -> CoefficientForm;
+
+    /**
+     * @brief Multiplies a dense polynomial by this one, as a sum of shifted and scaled copies of the dense polynomial.
+     * @param polynomial the dense polynomial.
+     * @return the dense product.
+     */
+    [[nodiscard]] auto multiply(const CoefficientForm &polynomial) const -> CoefficientForm;
+
+    /**
+     * @brief Adds this polynomial to a dense one, only touching the coefficients under its terms.
+     * @param polynomial the dense polynomial.
+     * @return the dense sum.
+     */
+    [[nodiscard]] auto add(const CoefficientForm &polynomial) const -> CoefficientForm;
+
+    /**
+     * @brief Divides a dense polynomial by this one with long division, where each step only updates the coefficients
+     *          under the terms of the divisor.
+     * @param dividend the dense polynomial to divide.
+     * @return the quotient and the remainder polynomials.
+     * @exception DIVISION_BY_ZERO this polynomial is zero.
+     */
+    [[nodiscard]] auto divide(const CoefficientForm &dividend) const -> std::pair<CoefficientForm, CoefficientForm>;
+
+public:
+    SparseCoefficientForm operator-() const;
+
+    SparseCoefficientForm &operator+=(const SparseCoefficientForm &polynomial);
+    SparseCoefficientForm &operator-=(const SparseCoefficientForm &polynomial);
+    SparseCoefficientForm &operator*=(const SparseCoefficientForm &polynomial);
+    SparseCoefficientForm &operator*=(const bls12_381::scalar::Scalar &value);
+
+public:
+    friend inline SparseCoefficientForm operator+(const SparseCoefficientForm &a, const SparseCoefficientForm &b) { return SparseCoefficientForm(a) += b; }
+    friend inline SparseCoefficientForm operator-(const SparseCoefficientForm &a, const SparseCoefficientForm &b) { return SparseCoefficientForm(a) -= b; }
+    friend inline SparseCoefficientForm operator*(const SparseCoefficientForm &a, const SparseCoefficientForm &b) { return SparseCoefficientForm(a) *= b; }
+    friend inline SparseCoefficientForm operator*(const SparseCoefficientForm &a, const bls12_381::scalar::Scalar &b) { return SparseCoefficientForm(a) *= b; }
+
+    friend inline CoefficientForm operator+(const CoefficientForm &a, const SparseCoefficientForm &b) { return b.add(a); }
+    friend inline CoefficientForm operator+(const SparseCoefficientForm &a, const CoefficientForm &b) { return a.add(b); }
+    friend inline CoefficientForm operator-(const CoefficientForm &a, const SparseCoefficientForm &b) { return (-b).add(a); }
+    friend inline CoefficientForm operator-(const SparseCoefficientForm &a, const CoefficientForm &b) { return a.add(-b); }
+    friend inline CoefficientForm operator*(const CoefficientForm &a, const SparseCoefficientForm &b) { return b.multiply(a); }
+    friend inline CoefficientForm operator*(const SparseCoefficientForm &a, const CoefficientForm &b) { return a.multiply(b); }
+
+    friend inline bool operator==(const SparseCoefficientForm &a, const SparseCoefficientForm &b) { return a.terms == b.terms; }
+    friend inline bool operator!=(const SparseCoefficientForm &a, const SparseCoefficientForm &b) { return a.terms != b.terms; }
+};
+
+} // namespace kzg::polynomial
+
+#endif //KZG_COMMITMENT_SPARSE_H
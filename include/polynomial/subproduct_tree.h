@@ -0,0 +1,75 @@
+#ifndef KZG_COMMITMENT_SUBPRODUCT_TREE_H
+#define KZG_COMMITMENT_SUBPRODUCT_TREE_H
+
+#include <memory>
+#include <vector>
+
+#include "scalar/scalar.h"
+
+#include "polynomial/coefficient.h"
+
+namespace kzg::polynomial {
+
+struct InterpolationWeights;
+
+/**
+ * @brief Represents the subproduct tree of a set of points, whose leaves are the linear factors (X - x_i) and whose
+ *          inner nodes are the products of their children.
+ * @details The tree is built once in O(n log ^ 2 n) and then reused to evaluate any polynomial at the points, or to
+ *          interpolate any values over them, each in O(n log ^ 2 n). All the products and divisions go through
+ *          <tt>multiply</tt> and <tt>divide</tt>. The nodes of the wide levels are split among the threads of
+ *          <tt>util::parallel</tt> with each product running serially, while the narrow levels near the root run their
+ *          nodes one by one and let each product use the threads, so the two never nest.
+ */
+class SubproductTree {
+private:
+    /// The points x_i.
+    std::vector<bls12_381::scalar::Scalar> points;
+    /// The nodes by level, from the leaves to the root. A node without sibling is carried up unchanged.
+    std::vector<std::vector<std::vector<bls12_381::scalar::Scalar>>> levels;
+    /// The barycentric weights 1 / M'(x_i), computed on the first interpolation and shared with the copies.
+    std::shared_ptr<InterpolationWeights> weights;
+
+public:
+    SubproductTree() = delete;
+    SubproductTree(const SubproductTree &tree);
+    SubproductTree(SubproductTree &&tree) noexcept;
+
+    /**
+     * @brief Builds the subproduct tree of a set of points.
+     * @param points the points, which must be distinct for interpolation.
+     * @exception SIZE_MISMATCH the set of points is empty.
+     */
+    explicit SubproductTree(std::vector<bls12_381::scalar::Scalar> points);
+
+    [[nodiscard]] auto get_points() const -> const std::vector<bls12_381::scalar::Scalar> &;
+
+    /// Gets the root M(X) = prod_i (X - x_i), the vanishing polynomial of the points.
+    [[nodiscard]] auto get_root() const -> CoefficientForm;
+
+    /**
+     * @brief Evaluates a polynomial at all the points, by reducing it modulo the nodes from the root down to the leaves.
+     * @param polynomial the polynomial to evaluate.
+     * @return the evaluations, in the order of the points.
+     */
+    [[nodiscard]] auto evaluate(const CoefficientForm &polynomial) const -> std::vector<bls12_381::scalar::Scalar>;
+
+    /**
+     * @brief Interpolates the polynomial of degree less than n taking the given values at the points.
+     * @details With w_i = 1 / M'(x_i), the result is sum_i v_i * w_i * M(X) / (X - x_i), which is combined from the
+     *          leaves up to the root.
+     * @param values the values at the points, in the order of the points.
+     * @return the interpolated polynomial.
+     * @exception SIZE_MISMATCH the number of values is different from the number of points.
+     * @exception DIVISION_BY_ZERO the points are not distinct.
+     */
+    [[nodiscard]] auto interpolate(const std::vector<bls12_381::scalar::Scalar> &values) const -> CoefficientForm;
+
+public:
+    SubproductTree &operator=(const SubproductTree &rhs);
+    SubproductTree &operator=(SubproductTree &&rhs) noexcept;
+};
+
+} // namespace kzg::polynomial
+
+#endif //KZG_COMMITMENT_SUBPRODUCT_TREE_H
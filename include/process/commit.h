@@ -2,6 +2,7 @@
 #define KZG_COMMITMENT_COMMIT_H
 
 #include "polynomial/coefficient.h"
+#include "polynomial/sparse.h"
 #include "structure/commit_key.h"
 #include "structure/commitment.h"
 
@@ -18,6 +19,17 @@ auto commit(
         const polynomial::CoefficientForm &polynomial
 ) -> structure::Commitment;
 
+/**
+ * @brief Commits to a polynomial in sparse coefficient form, with one scalar multiplication per term.
+ * @param commit_key the committing key.
+ * @param polynomial the to-be-committed polynomial in sparse coefficient form.
+ * @return the corresponding commitment.
+ */
+auto commit(
+        const structure::CommitKey &commit_key,
+        const polynomial::SparseCoefficientForm &polynomial
+) -> structure::Commitment;
+
 } // namespace kzg::process::commit
 
 #endif //KZG_COMMITMENT_COMMIT_H
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "scalar/scalar.h"
 
 #include "polynomial/coefficient.h"
+#include "polynomial/sparse.h"
 #include "structure/commit_key.h"
 #include "structure/commitment.h"
 #include "structure/proofs.h"
@@ -25,6 +26,20 @@ auto create_witness_single(
         const bls12_381::scalar::Scalar &point
 ) -> structure::Proof;
 
+/**
+ * @brief Computes a single witness for a polynomial in sparse form committed at a given point.
+ * @details The polynomial is evaluated and divided by (X - point) directly from its terms.
+ * @param commit_key the committing key.
+ * @param polynomial the committed polynomial in sparse coefficient form.
+ * @param point the point for the polynomial to be evaluated.
+ * @return the witness for evaluation.
+ */
+auto create_witness_single(
+        const structure::CommitKey &commit_key,
+        const polynomial::SparseCoefficientForm &polynomial,
+        const bls12_381::scalar::Scalar &point
+) -> structure::Proof;
+
 /**
  * @brief Computes a single witness for multiple polynomials committed at a same point by taking a random linear
  *          combination of the individual witnesses.
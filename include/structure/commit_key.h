@@ -2,25 +2,53 @@
 #define KZG_COMMITMENT_COMMIT_KEY_H
 
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <vector>
 
 #include "group/g1_affine.h"
 #include "polynomial/coefficient.h"
+#include "polynomial/sparse.h"
 
 namespace kzg::structure {
 
 /**
  * @brief <tt>CommitKey</tt> is used to commit to a polynomial which is bounded by the <tt>max_degree</tt>.
+ * @details The key is a view over a shared backing store of group elements, so that keys truncated from a same
+ *          reference string share their points instead of copying them.
  */
 class CommitKey {
 private:
-    /// Group elements of the form `beta ^ i * g`, where `i` ranges from 0 to <tt>degree</tt>.
-    std::vector<bls12_381::group::G1Affine> powers_of_g;
+    /// Group elements of the form `beta ^ i * g`, shared by all the keys truncated from a same store.
+    std::shared_ptr<const std::vector<bls12_381::group::G1Affine>> powers_of_g;
+    /// the number of leading elements of <tt>powers_of_g</tt> visible to this key, i.e. <tt>degree</tt> + 1.
+    size_t length;
+
+    /// A copy of the visible elements of a truncated key, only built for <tt>get_powers_of_g</tt>.
+    struct TruncatedPowers {
+        std::once_flag flag;
+        std::vector<bls12_381::group::G1Affine> powers;
+    };
+    std::shared_ptr<TruncatedPowers> truncated_powers;
 
 public:
     CommitKey() = delete;
     explicit CommitKey(const std::vector<bls12_381::group::G1Affine> &vec);
-    [[nodiscard]] const std::vector<bls12_381::group::G1Affine> &get_powers_of_g() const;
+    explicit CommitKey(std::vector<bls12_381::group::G1Affine> &&vec);
+    CommitKey(std::shared_ptr<const std::vector<bls12_381::group::G1Affine>> storage, size_t length);
+
+    /**
+     * @return the group elements visible to this key, viewed in place in the shared backing store.
+     */
+    [[nodiscard]] auto get_powers_of_g_view() const -> std::span<const bls12_381::group::G1Affine>;
+
+    /**
+     * @return the group elements visible to this key as a vector.
+     * @remark A truncated key does not own a vector of its own elements, so the first call on such a key copies them
+     *          once. Prefer <tt>get_powers_of_g_view</tt>, which never copies.
+     */
+    [[nodiscard]] auto get_powers_of_g() const -> const std::vector<bls12_381::group::G1Affine> &;
 
     /**
      * @return the maximum degree of the polynomial that can be committed to.
@@ -29,6 +57,7 @@ public:
 
     /**
      * Truncates the <tt>CommitKey</tt> to one with smaller <tt>max_degree</tt>.
+     * @details The truncated key shares the backing store of this key, so truncation takes constant time.
      * @param new_degree the new value of <tt>max_degree</tt>.
      * @return The truncated <tt>CommitKey</tt>.
      * @exception TRUNCATED_DEGREE_IS_ZERO the <tt>new_degree</tt> is zero.
@@ -44,11 +73,45 @@ public:
      */
     void check_polynomial_degree(const polynomial::CoefficientForm &polynomial) const;
 
+    /**
+     * Checks the degree of the committed polynomial in sparse form.
+     * @param polynomial a to-be-committed polynomial in sparse coefficient form.
+     * @exception PolyDegreeIsZero the polynomial has zero degree.
+     * @exception PolyDegreeTooLarge degree of the polynomial is larger than <tt>max_degree</tt>.
+     */
+    void check_polynomial_degree(const polynomial::SparseCoefficientForm &polynomial) const;
+
     [[nodiscard]] std::vector<uint8_t> to_raw_var_bytes() const;
     [[nodiscard]] std::vector<uint8_t> to_var_bytes() const;
 
-    static CommitKey from_slice_unchecked(const std::vector<uint8_t> &bytes);
-    static std::optional<CommitKey> from_slice(const std::vector<uint8_t> &bytes);
+    /// Size of the raw serialized key in bytes.
+    [[nodiscard]] auto raw_var_bytes_size() const -> size_t;
+    /// Size of the compressed serialized key in bytes.
+    [[nodiscard]] auto var_bytes_size() const -> size_t;
+
+    /**
+     * Serializes the key in raw form in place into a caller-provided buffer.
+     * @param buffer the buffer to write to, of at least <tt>raw_var_bytes_size()</tt> bytes.
+     * @exception SERIALIZE_NO_ENOUGH_BYTES the buffer is too small.
+     */
+    void write_raw_var_bytes(std::span<uint8_t> buffer) const;
+
+    /**
+     * Serializes the key in compressed form in place into a caller-provided buffer.
+     * @param buffer the buffer to write to, of at least <tt>var_bytes_size()</tt> bytes.
+     * @exception SERIALIZE_NO_ENOUGH_BYTES the buffer is too small.
+     */
+    void write_var_bytes(std::span<uint8_t> buffer) const;
+
+    static CommitKey from_slice_unchecked(std::span<const uint8_t> bytes);
+
+    /**
+     * Deserializes a <tt>CommitKey</tt> from its compressed form produced by <tt>to_var_bytes</tt>.
+     * @details The group elements are decompressed in parallel chunks, see <tt>util::parallel::num_threads</tt>.
+     * @param bytes the compressed group elements.
+     * @return the deserialized key, or nothing if any of the elements is invalid.
+     */
+    static std::optional<CommitKey> from_slice(std::span<const uint8_t> bytes);
 };
 
 } // namespace kzg::structure
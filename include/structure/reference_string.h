@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <tuple>
 #include <optional>
+#include <span>
 #include <vector>
 
 #include "core/rng.h"
@@ -46,10 +47,41 @@ public:
      */
     auto trim(size_t truncated_degree) -> std::tuple<CommitKey, OpeningKey>;
 
+    /**
+     * @brief Checks that the powers of g in the commit key are successive powers of the same secret beta as the one
+     *          hidden in <tt>h_beta</tt> of the opening key.
+     * @details All the relations e(g_{i+1}, h) = e(g_i, h_beta) are folded into two random linear combinations
+     *          A = sum(r_i * g_{i+1}) and B = sum(r_i * g_i), which are then checked with e(A, h) = e(B, h_beta). A
+     *          malformed reference string passes with negligible probability.
+     * @param rng the random number generator used to sample the combination coefficients.
+     * @return the verification result.
+     */
+    [[nodiscard]] auto verify_structure(rng::core::RngCore &rng) const -> bool;
+
     [[nodiscard]] auto to_var_bytes() const -> std::vector<uint8_t>;
     [[nodiscard]] auto to_raw_var_bytes() const -> std::vector<uint8_t>;
-    static auto from_slice(const std::vector<uint8_t> &bytes) -> std::optional<ReferenceString>;
-    static auto from_slice_unchecked(const std::vector<uint8_t> &bytes) -> ReferenceString;
+
+    /// Size of the compressed serialized reference string in bytes.
+    [[nodiscard]] auto var_bytes_size() const -> size_t;
+    /// Size of the raw serialized reference string in bytes.
+    [[nodiscard]] auto raw_var_bytes_size() const -> size_t;
+
+    /**
+     * @brief Serializes the reference string in compressed form in place into a caller-provided buffer.
+     * @param buffer the buffer to write to, of at least <tt>var_bytes_size()</tt> bytes.
+     * @exception SERIALIZE_NO_ENOUGH_BYTES the buffer is too small.
+     */
+    void write_var_bytes(std::span<uint8_t> buffer) const;
+
+    /**
+     * @brief Serializes the reference string in raw form in place into a caller-provided buffer.
+     * @param buffer the buffer to write to, of at least <tt>raw_var_bytes_size()</tt> bytes.
+     * @exception SERIALIZE_NO_ENOUGH_BYTES the buffer is too small.
+     */
+    void write_raw_var_bytes(std::span<uint8_t> buffer) const;
+
+    static auto from_slice(std::span<const uint8_t> bytes) -> std::optional<ReferenceString>;
+    static auto from_slice_unchecked(std::span<const uint8_t> bytes) -> ReferenceString;
 };
 
 } // namespace kzg::structure
@@ -1,6 +1,7 @@
 #ifndef KZG_COMMITMENT_FIELD_H
 #define KZG_COMMITMENT_FIELD_H
 
+#include <span>
 #include <vector>
 
 #include "core/rng.h"
@@ -16,7 +17,18 @@ namespace kzg::util::field {
 auto random_scalar(rng::core::RngCore &rng) -> bls12_381::scalar::Scalar;
 
 std::vector<bls12_381::scalar::Scalar> generate_vec_powers(const bls12_381::scalar::Scalar &value, size_t max_degree);
-void batch_inversion(std::vector<bls12_381::scalar::Scalar> &scalars);
+
+/// the minimum number of scalars inverted by one thread in <tt>batch_inversion</tt>.
+constexpr size_t BATCH_INVERSION_CHUNK_SIZE = 1024;
+
+/**
+ * @brief Inverts scalars in place with Montgomery's trick, zeros are left unchanged.
+ * @details The scalars are split into one chunk per thread. Each chunk computes the prefix products of its non-zero
+ *          scalars, the chunk products are inverted together with a single field inversion, then each chunk unwinds
+ *          its prefix products from the inverse of its own product.
+ * @param scalars the scalars to invert.
+ */
+void batch_inversion(std::span<bls12_381::scalar::Scalar> scalars);
 
 } // namespace kzg::util::field
 
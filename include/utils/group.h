@@ -1,9 +1,11 @@
 #ifndef KZG_COMMITMENT_GROUP_H
 #define KZG_COMMITMENT_GROUP_H
 
+#include <span>
 #include <vector>
 
 #include "core/rng.h"
+#include "group/g1_affine.h"
 #include "group/g1_projective.h"
 #include "group/g2_projective.h"
 
@@ -28,6 +30,17 @@ std::vector<bls12_381::group::G1Projective> slow_multi_scalar_mul_single_base(
         const bls12_381::group::G1Projective &base
 );
 
+/**
+ * @brief Computes the multi-scalar multiplication <tt>sum(scalars[i] * bases[i])</tt> using Pippenger's bucket method.
+ * @param bases the group elements
+ * @param scalars the scalars, must have the same length as <tt>bases</tt>
+ * @return the linear combination of the group elements
+ */
+auto multi_scalar_mul(
+        std::span<const bls12_381::group::G1Affine> bases,
+        std::span<const bls12_381::scalar::Scalar> scalars
+) -> bls12_381::group::G1Projective;
+
 } // namespace kzg::util::group
 
 #endif //KZG_COMMITMENT_GROUP_H
\ No newline at end of file
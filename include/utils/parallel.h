@@ -0,0 +1,73 @@
+#ifndef KZG_COMMITMENT_PARALLEL_H
+#define KZG_COMMITMENT_PARALLEL_H
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace kzg::util::parallel {
+
+/**
+ * @brief Gets the number of worker threads used by the parallel routines of the library.
+ * @return the configured thread count, or the hardware concurrency if it was never configured.
+ */
+auto num_threads() -> size_t;
+
+/**
+ * @brief Sets the number of worker threads used by the parallel routines of the library.
+ * @param threads the thread count, zero resets it to the hardware concurrency.
+ */
+void set_num_threads(size_t threads);
+
+/// Whether the calling thread is running a chunk of a parallel loop, where nested loops run inline.
+auto in_parallel_region() -> bool;
+
+/**
+ * @brief Sets the number of worker threads for the lifetime of the guard, and restores the previous setting when it
+ *          is destroyed.
+ */
+class ScopedNumThreads {
+private:
+    size_t previous;
+
+public:
+    explicit ScopedNumThreads(size_t threads);
+    ScopedNumThreads(const ScopedNumThreads &) = delete;
+    ScopedNumThreads &operator=(const ScopedNumThreads &) = delete;
+    ~ScopedNumThreads();
+};
+
+namespace detail {
+
+/// A non-owning reference to a chunk task, so that dispatching a loop neither copies nor allocates the task.
+struct TaskRef {
+    void *object;
+    void (*call)(void *object, size_t begin, size_t end);
+};
+
+void parallel_for(size_t size, TaskRef task, size_t min_chunk_size);
+
+} // namespace detail
+
+/**
+ * @brief Splits the index range [0, size) into contiguous chunks and runs <tt>task(begin, end)</tt> on each chunk,
+ *          spread among a persistent pool of worker threads and the calling thread.
+ * @details Runs inline when a single chunk is enough, when called from a chunk of another loop, or when another
+ *          thread is already running a loop on the pool, so that nested loops never oversubscribe the cores. The first
+ *          exception thrown by a chunk is rethrown on the calling thread once all the started chunks are finished.
+ * @param size the length of the index range.
+ * @param task the task to be applied on each chunk.
+ * @param min_chunk_size the minimum number of indices handled by one thread.
+ */
+template<typename Task>
+void parallel_for(size_t size, Task &&task, size_t min_chunk_size = 1) {
+    using Object = std::remove_reference_t<Task>;
+    detail::parallel_for(size, detail::TaskRef{
+            const_cast<void *>(static_cast<const void *>(std::addressof(task))),
+            [](void *object, size_t begin, size_t end) { (*static_cast<Object *>(object))(begin, end); }
+    }, min_chunk_size);
+}
+
+} // namespace kzg::util::parallel
+
+#endif //KZG_COMMITMENT_PARALLEL_H
@@ -0,0 +1,81 @@
+#ifndef KZG_COMMITMENT_WORKSPACE_H
+#define KZG_COMMITMENT_WORKSPACE_H
+
+#include <cstddef>
+#include <vector>
+
+#include "scalar/scalar.h"
+
+namespace kzg::util::workspace {
+
+/// The maximum number of buffers kept by the workspace of a thread.
+constexpr size_t MAX_POOLED_BUFFERS = 32;
+/// The maximum number of bytes of storage kept by the workspace of a thread.
+constexpr size_t MAX_POOLED_BYTES = static_cast<size_t>(256) << 20;
+
+/**
+ * @brief Takes a buffer from the workspace of the calling thread, so that the storage released by previous operations
+ *          is reused instead of being allocated again.
+ * @details The smallest pooled buffer large enough is taken, a new one is allocated if there is none.
+ * @param size the number of elements of the buffer.
+ * @return a buffer of <tt>size</tt> zeros.
+ */
+auto acquire(size_t size) -> std::vector<bls12_381::scalar::Scalar>;
+
+/**
+ * @brief Takes a buffer from the workspace of the calling thread like <tt>acquire</tt>, but without zeroing it, for
+ *          callers which overwrite every element.
+ * @details The elements left by the previous user of the storage are kept, only the elements past them are
+ *          initialized.
+ * @param size the number of elements of the buffer.
+ * @return a buffer of <tt>size</tt> elements of unspecified values.
+ */
+auto acquire_uninitialized(size_t size) -> std::vector<bls12_381::scalar::Scalar>;
+
+/**
+ * @brief Gives the storage of a buffer back to the workspace of the calling thread. The smallest buffers are freed
+ *          when more than <tt>MAX_POOLED_BUFFERS</tt> buffers or <tt>MAX_POOLED_BYTES</tt> bytes are pooled, and a
+ *          buffer larger than <tt>MAX_POOLED_BYTES</tt> is freed at once.
+ * @param buffer the buffer to recycle, left empty.
+ */
+void recycle(std::vector<bls12_381::scalar::Scalar> &&buffer);
+
+/// Number of buffers currently pooled by the workspace of the calling thread.
+auto pooled_buffers() -> size_t;
+
+/// Number of bytes of storage currently pooled by the workspace of the calling thread.
+auto pooled_bytes() -> size_t;
+
+/// Frees all the buffers pooled by the workspace of the calling thread.
+void clear();
+
+/**
+ * @brief A buffer taken from the workspace of the calling thread for the duration of a scope, and recycled when it is
+ *          destroyed.
+ */
+class ScratchBuffer {
+private:
+    std::vector<bls12_381::scalar::Scalar> buffer;
+
+public:
+    explicit ScratchBuffer(size_t size);
+    explicit ScratchBuffer(std::vector<bls12_381::scalar::Scalar> &&buffer);
+    ScratchBuffer(const ScratchBuffer &) = delete;
+    ScratchBuffer(ScratchBuffer &&rhs) noexcept = default;
+    ~ScratchBuffer();
+
+    ScratchBuffer &operator=(const ScratchBuffer &) = delete;
+    ScratchBuffer &operator=(ScratchBuffer &&rhs) noexcept = delete;
+
+    std::vector<bls12_381::scalar::Scalar> &operator*() { return this->buffer; }
+    const std::vector<bls12_381::scalar::Scalar> &operator*() const { return this->buffer; }
+    std::vector<bls12_381::scalar::Scalar> *operator->() { return &this->buffer; }
+    const std::vector<bls12_381::scalar::Scalar> *operator->() const { return &this->buffer; }
+
+    /// Takes the buffer out of the scope, it is not recycled anymore.
+    auto take() -> std::vector<bls12_381::scalar::Scalar>;
+};
+
+} // namespace kzg::util::workspace
+
+#endif //KZG_COMMITMENT_WORKSPACE_H
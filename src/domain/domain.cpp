@@ -1,7 +1,11 @@
 #include "domain/domain.h"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cstdint>
+#include <mutex>
+#include <numeric>
 #include <utility>
 
 #include "scalar/constant.h"
@@ -11,6 +15,7 @@
 #include "polynomial/evaluation.h"
 #include "utils/field.h"
 #include "utils/bit.h"
+#include "utils/parallel.h"
 
 namespace kzg::domain {
 
@@ -20,26 +25,84 @@ using bls12_381::scalar::Scalar;
 
 using exception::Exception;
 using exception::Type;
+using util::parallel::parallel_for;
 
 const uint64_t TWO_ADACITY = 32;
 
-EvaluationDomain::EvaluationDomain() : group_gen{Scalar::zero()}, domain_size{} {}
+/// the maximum number of columns interleaved together by the batched FFT.
+const size_t BATCH_FOURIER_WIDTH = 8;
+
+struct TwiddleCache {
+    std::once_flag forward_flag;
+    std::vector<Scalar> forward;
+    std::once_flag inverse_flag;
+    std::vector<Scalar> inverse;
+    std::once_flag elements_flag;
+    std::vector<Scalar> elements;
+};
+
+/// Caches of the canonical subgroups, indexed by log of the size, so that domains of a same size share twiddles.
+std::array<std::weak_ptr<TwiddleCache>, TWO_ADACITY> canonical_caches;
+std::mutex canonical_caches_mutex;
+
+std::shared_ptr<TwiddleCache> canonical_cache(uint64_t log_size) {
+    std::lock_guard<std::mutex> lock{canonical_caches_mutex};
+    auto cache = canonical_caches[log_size].lock();
+    if (cache == nullptr) {
+        cache = std::make_shared<TwiddleCache>();
+        canonical_caches[log_size] = cache;
+    }
+    return cache;
+}
+
+Scalar invert_or_zero(const Scalar &value) {
+    const auto invert = value.invert();
+    return invert.has_value() ? invert.value() : Scalar::zero();
+}
+
+EvaluationDomain::EvaluationDomain()
+        : group_gen{Scalar::zero()}, domain_size{}, size_inv{Scalar::zero()}, group_gen_inv{Scalar::zero()},
+          twiddle_cache{std::make_shared<TwiddleCache>()} {}
 
 EvaluationDomain::EvaluationDomain(const EvaluationDomain &domain) = default;
 
-EvaluationDomain::EvaluationDomain(EvaluationDomain &&domain) noexcept = default;
+/// the twiddle cache is shared rather than moved, so the moved-from domain stays usable for transforms.
+EvaluationDomain::EvaluationDomain(EvaluationDomain &&domain) noexcept
+        : group_gen{domain.group_gen}, domain_size{domain.domain_size}, size_inv{domain.size_inv},
+          group_gen_inv{domain.group_gen_inv}, twiddle_cache{domain.twiddle_cache} {}
 
 EvaluationDomain::EvaluationDomain(Scalar generator, uint64_t size)
-        : group_gen{std::move(generator)}, domain_size{size} {}
+        : group_gen{std::move(generator)}, domain_size{size}, size_inv{invert_or_zero(Scalar{size})},
+          group_gen_inv{invert_or_zero(this->group_gen)}, twiddle_cache{std::make_shared<TwiddleCache>()} {}
 
 constexpr uint64_t next_power_of_two(uint64_t x) noexcept {
-    return x == 1 ? 1 : 1 << (64 - __builtin_clzl(x - 1));
+    return x == 1 ? 1 : static_cast<uint64_t>(1) << (64 - __builtin_clzl(x - 1));
 }
 
 constexpr uint64_t trailing_zeros(uint64_t x) noexcept {
     return __builtin_ctzl(x);
 }
 
+/// Exponent of GENERATOR giving a root of unity of order 3 * 2 ^ TWO_ADACITY, that is (r - 1) / (3 * 2 ^ 32).
+const std::array<uint64_t, 4> MIXED_ROOT_OF_UNITY_EXPONENT = {
+        0xaaaa1eaa55555555, 0x0335f2ac713f36ab, 0xb889d46d66689d58, 0x0000000026a48d1b
+};
+
+EvaluationDomain EvaluationDomain::mixed_radix(uint64_t num_of_coefficients) {
+    const uint64_t radix_2_size = next_power_of_two(num_of_coefficients);
+    const uint64_t radix_3_size = 3 * next_power_of_two((num_of_coefficients + 2) / 3);
+    if (radix_2_size <= radix_3_size) return EvaluationDomain{radix_2_size};
+
+    const uint64_t log_size = trailing_zeros(radix_3_size);
+    if (log_size > TWO_ADACITY)
+        throw Exception(Type::INVALID_EVALUATION_DOMAIN_SIZE, "Evaluation domain size is too large.");
+
+    Scalar group_generator = bls12_381::scalar::constant::GENERATOR.pow(MIXED_ROOT_OF_UNITY_EXPONENT);
+    for (uint64_t i = log_size; i < TWO_ADACITY; ++i)
+        group_generator = group_generator.square();
+    return EvaluationDomain{group_generator, radix_3_size};
+}
+
 EvaluationDomain::EvaluationDomain(uint64_t num_of_coefficients) {
     const uint64_t size = next_power_of_two(num_of_coefficients);
     const uint64_t log_size = trailing_zeros(size);
@@ -52,12 +115,19 @@ EvaluationDomain::EvaluationDomain(uint64_t num_of_coefficients) {
         group_generator = group_generator.square();
     this->domain_size = size;
     this->group_gen = group_generator;
+    this->size_inv = invert_or_zero(this->size_as_field_element());
+    this->group_gen_inv = invert_or_zero(this->group_gen);
+    this->twiddle_cache = canonical_cache(log_size);
 }
 
 size_t EvaluationDomain::size() const noexcept {
     return static_cast<size_t>(this->domain_size);
 }
 
+bool EvaluationDomain::is_radix_2() const noexcept {
+    return (this->domain_size & (this->domain_size - 1)) == 0;
+}
+
 size_t EvaluationDomain::log_size() const noexcept {
     return static_cast<size_t>(trailing_zeros(this->domain_size));
 }
@@ -67,9 +137,8 @@ Scalar EvaluationDomain::size_as_field_element() const {
 }
 
 Scalar EvaluationDomain::size_inverse() const {
-    const auto invert = this->size_as_field_element().invert();
-    assert(invert.has_value());
-    return invert.value();
+    assert(!this->size_inv.is_zero());
+    return this->size_inv;
 }
 
 Scalar EvaluationDomain::group_generator() const {
@@ -77,9 +146,41 @@ Scalar EvaluationDomain::group_generator() const {
 }
 
 Scalar EvaluationDomain::group_generator_inverse() const {
-    const auto invert = this->group_gen.invert();
-    assert(invert.has_value());
-    return invert.value();
+    assert(!this->group_gen_inv.is_zero());
+    return this->group_gen_inv;
+}
+
+const std::vector<Scalar> &EvaluationDomain::twiddles() const {
+    std::call_once(this->twiddle_cache->forward_flag, [this] {
+        const Scalar omega = this->is_radix_2() ? this->group_gen : this->group_gen.square() * this->group_gen;
+        this->twiddle_cache->forward = compute_twiddles(omega, this->log_size());
+    });
+    return this->twiddle_cache->forward;
+}
+
+const std::vector<Scalar> &EvaluationDomain::inverse_twiddles() const {
+    std::call_once(this->twiddle_cache->inverse_flag, [this] {
+        const Scalar omega = this->is_radix_2() ? this->group_gen_inv
+                                                : this->group_gen_inv.square() * this->group_gen_inv;
+        this->twiddle_cache->inverse = compute_twiddles(omega, this->log_size());
+    });
+    return this->twiddle_cache->inverse;
+}
+
+ElementRange EvaluationDomain::elements() const {
+    std::call_once(this->twiddle_cache->elements_flag, [this] {
+        auto &elements = this->twiddle_cache->elements;
+        elements.resize(this->domain_size);
+        parallel_for(this->domain_size, [&](size_t begin, size_t end) {
+            Scalar power = this->group_gen.pow({begin, 0, 0, 0});
+            for (size_t i = begin; i < end; ++i) {
+                elements[i] = power;
+                power *= this->group_gen;
+            }
+        }, 1024);
+    });
+    // the range keeps the whole cache alive through the aliasing constructor.
+    return ElementRange{std::shared_ptr<const std::vector<Scalar>>{this->twiddle_cache, &this->twiddle_cache->elements}};
 }
 
 std::vector<Scalar> EvaluationDomain::fast_fourier(std::vector<Scalar> &coefficients) const {
@@ -104,37 +205,152 @@ std::vector<Scalar> EvaluationDomain::coset_inverse_fast_fourier(std::vector<Sca
 
 void EvaluationDomain::fast_fourier_in_place(std::vector<Scalar> &coefficients) const {
     coefficients.resize(this->domain_size, Scalar::zero());
-    serial_fast_fourier(coefficients, this->group_gen, this->log_size());
+    if (this->is_radix_2())
+        best_fast_fourier(coefficients, this->twiddles(), this->log_size());
+    else
+        radix_3_fast_fourier(coefficients, this->group_gen, this->twiddles(), this->log_size());
 }
 
 void EvaluationDomain::inverse_fast_fourier_in_place(std::vector<Scalar> &evaluations) const {
     evaluations.resize(this->domain_size, Scalar::zero());
-    serial_fast_fourier(evaluations, this->group_generator_inverse(), this->log_size());
-    for (auto &evaluation: evaluations) evaluation *= this->size_inverse();
+    if (this->is_radix_2())
+        best_fast_fourier(evaluations, this->inverse_twiddles(), this->log_size());
+    else
+        radix_3_fast_fourier(evaluations, this->group_gen_inv, this->inverse_twiddles(), this->log_size());
+    const Scalar size_inverse = this->size_inverse();
+    for (auto &evaluation: evaluations) evaluation *= size_inverse;
+}
+
+/// Transforms the columns in groups of at most BATCH_FOURIER_WIDTH, each group interleaved into a single buffer.
+void batch_fast_fourier_columns(std::vector<std::vector<Scalar>> &columns, const std::vector<Scalar> &twiddles,
+                                uint32_t log_size) {
+    const size_t size = static_cast<size_t>(1) << log_size;
+    const size_t groups = (columns.size() + BATCH_FOURIER_WIDTH - 1) / BATCH_FOURIER_WIDTH;
+    parallel_for(groups, [&](size_t begin, size_t end) {
+        for (size_t group = begin; group < end; ++group) {
+            const size_t first = group * BATCH_FOURIER_WIDTH;
+            const size_t width = std::min(BATCH_FOURIER_WIDTH, columns.size() - first);
+
+            std::vector<Scalar> interleaved(size * width);
+            for (size_t c = 0; c < width; ++c)
+                for (size_t i = 0; i < size; ++i)
+                    interleaved[i * width + c] = columns[first + c][i];
+            batch_fast_fourier(interleaved, width, twiddles, log_size);
+            for (size_t c = 0; c < width; ++c)
+                for (size_t i = 0; i < size; ++i)
+                    columns[first + c][i] = interleaved[i * width + c];
+        }
+    });
+}
+
+void EvaluationDomain::fast_fourier_batch_in_place(std::vector<std::vector<Scalar>> &columns) const {
+    if (!this->is_radix_2()) {
+        for (auto &column: columns) this->fast_fourier_in_place(column);
+        return;
+    }
+    for (auto &column: columns) column.resize(this->domain_size, Scalar::zero());
+    batch_fast_fourier_columns(columns, this->twiddles(), this->log_size());
+}
+
+void EvaluationDomain::inverse_fast_fourier_batch_in_place(std::vector<std::vector<Scalar>> &columns) const {
+    if (!this->is_radix_2()) {
+        for (auto &column: columns) this->inverse_fast_fourier_in_place(column);
+        return;
+    }
+    for (auto &column: columns) column.resize(this->domain_size, Scalar::zero());
+    batch_fast_fourier_columns(columns, this->inverse_twiddles(), this->log_size());
+    const Scalar size_inverse = this->size_inverse();
+    parallel_for(columns.size(), [&](size_t begin, size_t end) {
+        for (size_t c = begin; c < end; ++c)
+            for (auto &evaluation: columns[c]) evaluation *= size_inverse;
+    });
+}
+
+void EvaluationDomain::fast_fourier_bit_reversed_in_place(std::vector<Scalar> &coefficients) const {
+    if (!this->is_radix_2())
+        throw Exception(Type::INVALID_EVALUATION_DOMAIN_SIZE, "bit-reversed order needs a power of 2 domain size.");
+    coefficients.resize(this->domain_size, Scalar::zero());
+    decimation_in_frequency_fast_fourier(coefficients, this->twiddles(), this->log_size());
+}
+
+void EvaluationDomain::inverse_fast_fourier_bit_reversed_in_place(std::vector<Scalar> &evaluations) const {
+    if (!this->is_radix_2())
+        throw Exception(Type::INVALID_EVALUATION_DOMAIN_SIZE, "bit-reversed order needs a power of 2 domain size.");
+    evaluations.resize(this->domain_size, Scalar::zero());
+    decimation_in_time_fast_fourier(evaluations, this->inverse_twiddles(), this->log_size());
+    const Scalar size_inverse = this->size_inverse();
+    for (auto &evaluation: evaluations) evaluation *= size_inverse;
+}
+
+void EvaluationDomain::fast_fourier_pruned_in_place(std::vector<Scalar> &coefficients, size_t output_length) const {
+    assert(output_length <= this->domain_size);
+    if (!this->is_radix_2()) {
+        this->fast_fourier_in_place(coefficients);
+        coefficients.resize(output_length);
+        return;
+    }
+    const size_t input_length = std::min(coefficients.size(), this->size());
+    coefficients.resize(this->domain_size, Scalar::zero());
+    pruned_fast_fourier(coefficients, input_length, output_length, this->twiddles(), this->log_size());
+}
+
+void EvaluationDomain::fast_fourier_bit_reversed_pruned_in_place(std::vector<Scalar> &coefficients) const {
+    if (!this->is_radix_2())
+        throw Exception(Type::INVALID_EVALUATION_DOMAIN_SIZE, "bit-reversed order needs a power of 2 domain size.");
+    const size_t input_length = std::min(coefficients.size(), this->size());
+    coefficients.resize(this->domain_size, Scalar::zero());
+    pruned_decimation_in_frequency_fast_fourier(coefficients, input_length, this->twiddles(), this->log_size());
+}
+
+void EvaluationDomain::inverse_fast_fourier_bit_reversed_pruned_in_place(std::vector<Scalar> &evaluations,
+                                                                         size_t output_length) const {
+    if (!this->is_radix_2())
+        throw Exception(Type::INVALID_EVALUATION_DOMAIN_SIZE, "bit-reversed order needs a power of 2 domain size.");
+    assert(output_length <= this->domain_size);
+    evaluations.resize(this->domain_size, Scalar::zero());
+    pruned_decimation_in_time_fast_fourier(evaluations, output_length, this->inverse_twiddles(), this->log_size());
+    const Scalar size_inverse = this->size_inverse();
+    for (auto &evaluation: evaluations) evaluation *= size_inverse;
 }
 
 void EvaluationDomain::coset_fast_fourier_in_place(std::vector<Scalar> &coefficients) const {
-    distribute_powers(coefficients, bls12_381::scalar::constant::GENERATOR);
-    this->fast_fourier_in_place(coefficients);
+    this->coset_fast_fourier_in_place(coefficients, bls12_381::scalar::constant::GENERATOR);
 }
 
 void EvaluationDomain::coset_inverse_fast_fourier_in_place(std::vector<Scalar> &evaluations) const {
+    this->coset_inverse_fast_fourier_in_place(evaluations, bls12_381::scalar::constant::GENERATOR);
+}
+
+void EvaluationDomain::coset_fast_fourier_in_place(std::vector<Scalar> &coefficients, const Scalar &shift) const {
+    distribute_powers(coefficients, shift);
+    this->fast_fourier_in_place(coefficients);
+}
+
+void EvaluationDomain::coset_inverse_fast_fourier_in_place(std::vector<Scalar> &evaluations,
+                                                           const Scalar &shift) const {
     this->inverse_fast_fourier_in_place(evaluations);
-    distribute_powers(evaluations, bls12_381::scalar::constant::GENERATOR.invert().value());
+    const auto shift_inverse = shift.invert();
+    assert(shift_inverse.has_value());
+    distribute_powers(evaluations, shift_inverse.value());
 }
 
 polynomial::EvaluationForm EvaluationDomain::evaluate_vanishing_polynomial_over_coset(uint64_t poly_degree) const {
     assert(this->domain_size > poly_degree);
-    const Scalar coset_generator = bls12_381::scalar::constant::GENERATOR.pow({poly_degree, 0, 0, 0});
-    std::vector<Scalar> v_h;
-    v_h.reserve(this->domain_size);
-    for (int i = 0; i < this->domain_size; ++i) {
-        v_h.push_back(
-                coset_generator
-                * this->group_gen.pow({poly_degree * i, 0, 0, 0})
-                - Scalar::one()
-        );
+    // (g * omega ^ i) ^ d - 1 repeats with the period n / gcd(n, d) of omega ^ d.
+    const uint64_t period = this->domain_size / std::gcd(this->domain_size, poly_degree);
+    const Scalar step = this->group_gen.pow({poly_degree, 0, 0, 0});
+    std::vector<Scalar> values;
+    values.reserve(period);
+    Scalar power = bls12_381::scalar::constant::GENERATOR.pow({poly_degree, 0, 0, 0});
+    for (uint64_t i = 0; i < period; ++i) {
+        values.push_back(power - Scalar::one());
+        power *= step;
     }
+
+    std::vector<Scalar> v_h(this->domain_size);
+    parallel_for(this->domain_size, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) v_h[i] = values[i % period];
+    }, 1024);
     return polynomial::EvaluationForm{v_h, *this};
 }
 
@@ -204,6 +420,14 @@ std::array<uint8_t, EvaluationDomain::BYTE_SIZE> EvaluationDomain::to_bytes() co
 
 EvaluationDomain &EvaluationDomain::operator=(const EvaluationDomain &rhs) = default;
 
-EvaluationDomain &EvaluationDomain::operator=(EvaluationDomain &&rhs) noexcept = default;
+EvaluationDomain &EvaluationDomain::operator=(EvaluationDomain &&rhs) noexcept {
+    if (this == &rhs) return *this;
+    this->group_gen = rhs.group_gen;
+    this->domain_size = rhs.domain_size;
+    this->size_inv = rhs.size_inv;
+    this->group_gen_inv = rhs.group_gen_inv;
+    this->twiddle_cache = rhs.twiddle_cache;
+    return *this;
+}
 
 } // namespace kzg::domain
\ No newline at end of file
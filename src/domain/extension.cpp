@@ -0,0 +1,96 @@
+#include "domain/extension.h"
+
+#include "exception/exception.h"
+#include "utils/parallel.h"
+
+namespace kzg::domain {
+
+using bls12_381::scalar::Scalar;
+
+using exception::Exception;
+using exception::Type;
+using util::parallel::num_threads;
+using util::parallel::parallel_for;
+
+EvaluationDomain extended_domain(const EvaluationDomain &domain, size_t blowup) {
+    if (blowup == 0 || (blowup & (blowup - 1)) != 0)
+        throw Exception(Type::INVALID_EVALUATION_DOMAIN_SIZE, "blowup factor is not a power of two.");
+    return EvaluationDomain::mixed_radix(static_cast<uint64_t>(domain.size() * blowup));
+}
+
+std::vector<Scalar> extension_shifts(const EvaluationDomain &domain, size_t blowup, const Scalar &offset) {
+    const EvaluationDomain extended = extended_domain(domain, blowup);
+    const Scalar zeta = extended.group_generator();
+
+    std::vector<Scalar> shifts;
+    shifts.reserve(blowup);
+    Scalar shift = offset;
+    for (size_t i = 0; i < blowup; ++i) {
+        shifts.push_back(shift);
+        shift *= zeta;
+    }
+    return shifts;
+}
+
+std::vector<std::vector<Scalar>> evaluate_over_cosets(const EvaluationDomain &domain,
+                                                      const std::vector<Scalar> &coefficients,
+                                                      const std::vector<Scalar> &shifts) {
+    const size_t size = domain.size();
+    std::vector<std::vector<Scalar>> evaluations(shifts.size());
+
+    const auto evaluate_coset = [&](size_t index, bool serial) {
+        std::vector<Scalar> folded(size, Scalar::zero());
+        Scalar power = Scalar::one();
+        for (size_t i = 0; i < coefficients.size(); ++i) {
+            folded[i % size] += coefficients[i] * power;
+            power *= shifts[index];
+        }
+        if (serial && domain.is_radix_2())
+            serial_fast_fourier(folded, domain.twiddles(), domain.log_size());
+        else
+            domain.fast_fourier_in_place(folded);
+        evaluations[index] = std::move(folded);
+    };
+
+    // the cosets are spread among the threads when there are enough of them, otherwise each transform is parallel.
+    if (shifts.size() >= num_threads()) {
+        static_cast<void>(domain.twiddles());
+        parallel_for(shifts.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) evaluate_coset(i, true);
+        });
+    } else {
+        for (size_t i = 0; i < shifts.size(); ++i) evaluate_coset(i, false);
+    }
+    return evaluations;
+}
+
+std::vector<std::vector<Scalar>> low_degree_extension(const EvaluationDomain &domain,
+                                                      const std::vector<Scalar> &coefficients,
+                                                      size_t blowup,
+                                                      const Scalar &offset) {
+    if (coefficients.size() > domain.size() * blowup)
+        throw Exception(Type::POLY_DEGREE_TOO_LARGE, "degree of the extended polynomial is too large.");
+    return evaluate_over_cosets(domain, coefficients, extension_shifts(domain, blowup, offset));
+}
+
+std::vector<Scalar> inverse_low_degree_extension(const EvaluationDomain &domain,
+                                                 const std::vector<std::vector<Scalar>> &evaluations,
+                                                 const Scalar &offset) {
+    const size_t size = domain.size();
+    const size_t blowup = evaluations.size();
+    for (const auto &coset: evaluations)
+        if (coset.size() != size)
+            throw Exception(Type::SIZE_MISMATCH, "the coset evaluations do not match the domain size.");
+    const EvaluationDomain extended = extended_domain(domain, blowup);
+
+    // offset * zeta ^ i * omega ^ j is the (i + blowup * j)-th element of the extended coset, since omega = zeta ^ blowup.
+    std::vector<Scalar> interleaved(size * blowup);
+    for (size_t i = 0; i < blowup; ++i)
+        for (size_t j = 0; j < size; ++j)
+            interleaved[i + blowup * j] = evaluations[i][j];
+
+    extended.coset_inverse_fast_fourier_in_place(interleaved, offset);
+    return interleaved;
+}
+
+} // namespace kzg::domain
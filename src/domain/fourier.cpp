@@ -1,10 +1,19 @@
 #include "domain/fourier.h"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 
+#include "utils/parallel.h"
+#include "utils/workspace.h"
+
 namespace kzg::domain {
 
 using bls12_381::scalar::Scalar;
+using util::parallel::num_threads;
+using util::parallel::parallel_for;
+using util::workspace::acquire_uninitialized;
+using util::workspace::ScratchBuffer;
 
 constexpr uint32_t bit_reverse(uint32_t num, uint32_t length) {
     uint32_t res = 0;
@@ -15,10 +24,10 @@ constexpr uint32_t bit_reverse(uint32_t num, uint32_t length) {
     return res;
 }
 
-void distribute_powers(const std::vector<Scalar> &coefficients,
+void distribute_powers(std::vector<Scalar> &coefficients,
                        const Scalar &generator) {
     Scalar power = Scalar::one();
-    for (auto coeff: coefficients) {
+    for (auto &coeff: coefficients) {
         coeff *= power;
         power *= generator;
     }
@@ -53,4 +62,447 @@ void serial_fast_fourier(std::vector<Scalar> &a, const Scalar &omega, uint32_t l
     }
 }
 
+std::vector<Scalar> compute_twiddles(const Scalar &omega, uint32_t log_size) {
+    const uint64_t n = static_cast<uint64_t>(1) << log_size;
+    if (n == 1) return {};
+
+    const uint64_t half = n / 2;
+    std::vector<Scalar> twiddles(n - 1);
+    Scalar power = Scalar::one();
+    for (uint64_t j = 0; j < half; ++j) {
+        twiddles[half - 1 + j] = power;
+        power *= omega;
+    }
+    for (uint64_t m = half / 2; m >= 1; m /= 2) {
+        const uint64_t stride = half / m;
+        for (uint64_t j = 0; j < m; ++j)
+            twiddles[m - 1 + j] = twiddles[half - 1 + j * stride];
+    }
+    return twiddles;
+}
+
+/// Applies the butterflies of the stage merging blocks of size m to the n elements starting at a.
+void radix_2_stage(Scalar *a, uint64_t n, const Scalar *omega_m, uint64_t m) {
+    for (uint64_t k = 0; k < n; k += 2 * m) {
+        Scalar t = a[k + m];
+        a[k + m] = a[k] - t;
+        a[k] += t;
+        for (uint64_t j = 1; j < m; ++j) {
+            t = a[k + j + m] * omega_m[j];
+            a[k + j + m] = a[k + j] - t;
+            a[k + j] += t;
+        }
+    }
+}
+
+/**
+ * Applies the two stages merging blocks of size m and 2m in a single pass over the n elements starting at a. Each
+ * radix-4 butterfly loads four elements, performs the four radix-2 butterflies between them and stores them back.
+ */
+void radix_4_stage(Scalar *a, uint64_t n, const Scalar *twiddles, uint64_t m) {
+    const Scalar *omega_m = twiddles + (m - 1);
+    const Scalar *omega_2m = twiddles + (2 * m - 1);
+    for (uint64_t k = 0; k < n; k += 4 * m) {
+        for (uint64_t j = 0; j < m; ++j) {
+            Scalar &a0 = a[k + j];
+            Scalar &a1 = a[k + j + m];
+            Scalar &a2 = a[k + j + 2 * m];
+            Scalar &a3 = a[k + j + 3 * m];
+
+            const Scalar t1 = j == 0 ? a1 : a1 * omega_m[j];
+            const Scalar t3 = j == 0 ? a3 : a3 * omega_m[j];
+            const Scalar b0 = a0 + t1;
+            const Scalar b1 = a0 - t1;
+            const Scalar b2 = a2 + t3;
+            const Scalar b3 = a2 - t3;
+
+            const Scalar t2 = j == 0 ? b2 : b2 * omega_2m[j];
+            const Scalar t4 = b3 * omega_2m[j + m];
+            a0 = b0 + t2;
+            a2 = b0 - t2;
+            a1 = b1 + t4;
+            a3 = b1 - t4;
+        }
+    }
+}
+
+/// Applies all the butterfly stages of a transform of size n, whose input is already in bit-reversed order.
+void butterfly_stages(Scalar *a, uint64_t n, const Scalar *twiddles) {
+    uint64_t m = 1;
+    for (; 4 * m <= n; m *= 4)
+        radix_4_stage(a, n, twiddles, m);
+    if (m < n)
+        radix_2_stage(a, n, twiddles + (m - 1), m);
+}
+
+void bit_reverse_permutation(Scalar *a, uint32_t log_size) {
+    const uint64_t n = static_cast<uint64_t>(1) << log_size;
+    for (uint64_t k = 0; k < n; ++k) {
+        const uint64_t rk = bit_reverse(static_cast<uint32_t>(k), log_size);
+        if (k < rk) std::swap(a[rk], a[k]);
+    }
+}
+
+void serial_fast_fourier(std::vector<Scalar> &a, const std::vector<Scalar> &twiddles, uint32_t log_size) {
+    const auto n = static_cast<uint32_t>(a.size());
+    assert(n == (1 << log_size));
+    assert(twiddles.size() + 1 == n);
+
+    bit_reverse_permutation(a.data(), log_size);
+    butterfly_stages(a.data(), n, twiddles.data());
+}
+
+/// Applies all the butterfly stages of a transform of size n, splitting them among the threads.
+void parallel_butterfly_stages(Scalar *a, uint64_t n, uint32_t log_size, const Scalar *twiddles) {
+    uint32_t log_blocks = 0;
+    while ((static_cast<size_t>(1) << log_blocks) < num_threads() && log_blocks < log_size) log_blocks++;
+    const uint64_t block_size = n >> log_blocks;
+
+    parallel_for(static_cast<size_t>(1) << log_blocks, [&](size_t begin, size_t end) {
+        for (size_t block = begin; block < end; ++block)
+            butterfly_stages(a + block * block_size, block_size, twiddles);
+    });
+
+    for (uint64_t m = block_size; m < n; m *= 2) {
+        const Scalar *omega_m = twiddles + (m - 1);
+        parallel_for(n / 2, [&](size_t begin, size_t end) {
+            for (size_t b = begin; b < end; ++b) {
+                const uint64_t k = (b / m) * 2 * m;
+                const uint64_t j = b % m;
+                const Scalar t = a[k + j + m] * omega_m[j];
+                a[k + j + m] = a[k + j] - t;
+                a[k + j] += t;
+            }
+        });
+    }
+}
+
+void parallel_fast_fourier(std::vector<Scalar> &a, const std::vector<Scalar> &twiddles, uint32_t log_size) {
+    const uint64_t n = a.size();
+    assert(n == (static_cast<uint64_t>(1) << log_size));
+    assert(twiddles.size() + 1 == n);
+
+    parallel_for(n, [&](size_t begin, size_t end) {
+        for (size_t k = begin; k < end; ++k) {
+            const uint32_t rk = bit_reverse(static_cast<uint32_t>(k), log_size);
+            if (k < rk) std::swap(a[rk], a[k]);
+        }
+    });
+    parallel_butterfly_stages(a.data(), n, log_size, twiddles.data());
+}
+
+/// Applies the decimation-in-frequency butterflies of the stage splitting blocks of size 2m, for the blocks in range.
+void decimation_in_frequency_stage(Scalar *a, const Scalar *omega_m, uint64_t m, uint64_t first, uint64_t last) {
+    for (uint64_t b = first; b < last; ++b) {
+        const uint64_t k = (b / m) * 2 * m;
+        const uint64_t j = b % m;
+        const Scalar u = a[k + j];
+        const Scalar v = a[k + j + m];
+        a[k + j] = u + v;
+        a[k + j + m] = j == 0 ? u - v : (u - v) * omega_m[j];
+    }
+}
+
+void decimation_in_frequency_fast_fourier(std::vector<Scalar> &a, const std::vector<Scalar> &twiddles,
+                                          uint32_t log_size) {
+    const uint64_t n = a.size();
+    assert(n == (static_cast<uint64_t>(1) << log_size));
+    assert(twiddles.size() + 1 == n);
+
+    const bool parallel = log_size >= PARALLEL_FOURIER_MIN_LOG_SIZE && num_threads() > 1;
+    for (uint64_t m = n / 2; m >= 1; m /= 2) {
+        const Scalar *omega_m = twiddles.data() + (m - 1);
+        if (parallel) {
+            parallel_for(n / 2, [&](size_t begin, size_t end) {
+                decimation_in_frequency_stage(a.data(), omega_m, m, begin, end);
+            });
+        } else {
+            decimation_in_frequency_stage(a.data(), omega_m, m, 0, n / 2);
+        }
+    }
+}
+
+void decimation_in_time_fast_fourier(std::vector<Scalar> &a, const std::vector<Scalar> &twiddles,
+                                     uint32_t log_size) {
+    const uint64_t n = a.size();
+    assert(n == (static_cast<uint64_t>(1) << log_size));
+    assert(twiddles.size() + 1 == n);
+
+    if (log_size >= PARALLEL_FOURIER_MIN_LOG_SIZE && num_threads() > 1)
+        parallel_butterfly_stages(a.data(), n, log_size, twiddles.data());
+    else
+        butterfly_stages(a.data(), n, twiddles.data());
+}
+
+/// Gets the smallest log size of a transform holding the given number of entries.
+uint32_t ceil_log2(uint64_t length) {
+    uint32_t log_size = 0;
+    while ((static_cast<uint64_t>(1) << log_size) < length) log_size++;
+    return log_size;
+}
+
+/// Gets omega ^ exponent for exponent < n, from the last stage of the twiddle table holding the first n / 2 powers.
+Scalar twiddle_power(const Scalar *powers, uint64_t half, uint64_t exponent) {
+    return exponent < half ? powers[exponent] : -powers[exponent - half];
+}
+
+void pruned_decimation_in_frequency_fast_fourier(std::vector<Scalar> &a, size_t input_length,
+                                                 const std::vector<Scalar> &twiddles, uint32_t log_size) {
+    const uint64_t n = a.size();
+    assert(n == (static_cast<uint64_t>(1) << log_size));
+    assert(twiddles.size() + 1 == n);
+
+    const uint32_t log_block_size = ceil_log2(input_length);
+    if (log_block_size >= log_size) {
+        decimation_in_frequency_fast_fourier(a, twiddles, log_size);
+        return;
+    }
+
+    const uint32_t log_blocks = log_size - log_block_size;
+    const uint64_t block_size = static_cast<uint64_t>(1) << log_block_size;
+    const uint64_t half = n / 2;
+    const Scalar *powers = twiddles.data() + (half - 1);
+
+    // the first block holds the input itself, the other ones are filled from it before anything is transformed.
+    parallel_for((static_cast<size_t>(1) << log_blocks) - 1, [&](size_t begin, size_t end) {
+        for (size_t r = begin + 1; r <= end; ++r) {
+            const uint64_t step = bit_reverse(static_cast<uint32_t>(r), log_blocks);
+            Scalar *block = a.data() + r * block_size;
+            uint64_t exponent = 0;
+            for (uint64_t j = 0; j < input_length; ++j) {
+                block[j] = j == 0 ? a[0] : a[j] * twiddle_power(powers, half, exponent);
+                exponent = (exponent + step) & (n - 1);
+            }
+        }
+    });
+    parallel_for(static_cast<size_t>(1) << log_blocks, [&](size_t begin, size_t end) {
+        for (size_t r = begin; r < end; ++r)
+            for (uint64_t m = block_size / 2; m >= 1; m /= 2)
+                decimation_in_frequency_stage(a.data() + r * block_size, twiddles.data() + (m - 1), m, 0,
+                                              block_size / 2);
+    });
+}
+
+void pruned_decimation_in_time_fast_fourier(std::vector<Scalar> &a, size_t output_length,
+                                            const std::vector<Scalar> &twiddles, uint32_t log_size) {
+    const uint64_t n = a.size();
+    assert(n == (static_cast<uint64_t>(1) << log_size));
+    assert(twiddles.size() + 1 == n);
+    assert(output_length <= n);
+
+    const uint32_t log_block_size = ceil_log2(output_length);
+    if (log_block_size >= log_size) {
+        decimation_in_time_fast_fourier(a, twiddles, log_size);
+        a.resize(output_length);
+        return;
+    }
+
+    const uint32_t log_blocks = log_size - log_block_size;
+    const uint64_t blocks = static_cast<uint64_t>(1) << log_blocks;
+    const uint64_t block_size = static_cast<uint64_t>(1) << log_block_size;
+    const uint64_t half = n / 2;
+    const Scalar *powers = twiddles.data() + (half - 1);
+
+    // the r-th block holds the sub-sequence of the inputs of index bitrev(r) modulo 2 ^ s.
+    parallel_for(blocks, [&](size_t begin, size_t end) {
+        for (size_t r = begin; r < end; ++r)
+            butterfly_stages(a.data() + r * block_size, block_size, twiddles.data());
+    });
+
+    std::vector<Scalar> res(output_length);
+    parallel_for(output_length, [&](size_t begin, size_t end) {
+        for (uint64_t k = begin; k < end; ++k) {
+            res[k] = a[k];
+            for (uint64_t r = 1; r < blocks; ++r) {
+                const uint64_t exponent = (k * bit_reverse(static_cast<uint32_t>(r), log_blocks)) & (n - 1);
+                res[k] += a[r * block_size + k] * twiddle_power(powers, half, exponent);
+            }
+        }
+    }, 256);
+    a.swap(res);
+}
+
+void pruned_fast_fourier(std::vector<Scalar> &a, size_t input_length, size_t output_length,
+                         const std::vector<Scalar> &twiddles, uint32_t log_size) {
+    const uint64_t n = a.size();
+    assert(n == (static_cast<uint64_t>(1) << log_size));
+    assert(twiddles.size() + 1 == n);
+    assert(output_length <= n);
+
+    const uint32_t log_block_size = ceil_log2(output_length);
+    if (log_block_size >= log_size) {
+        pruned_decimation_in_frequency_fast_fourier(a, input_length, twiddles, log_size);
+        bit_reverse_permutation(a.data(), log_size);
+        a.resize(output_length);
+        return;
+    }
+
+    // X[k] = sum_c omega ^ (c * k) * F_c[k] for k < 2 ^ (log_size - s), F_c being the transform of the sub-sequence
+    // a[c + 2 ^ s * i], which is evaluated by Horner's rule in omega ^ k.
+    const uint32_t log_blocks = log_size - log_block_size;
+    const uint64_t blocks = static_cast<uint64_t>(1) << log_blocks;
+    const uint64_t block_size = static_cast<uint64_t>(1) << log_block_size;
+    const Scalar *powers = twiddles.data() + (n / 2 - 1);
+
+    std::vector<Scalar> sub_transforms(n, Scalar::zero());
+    parallel_for(blocks, [&](size_t begin, size_t end) {
+        for (size_t c = begin; c < end; ++c) {
+            Scalar *block = sub_transforms.data() + c * block_size;
+            for (uint64_t i = 0; c + i * blocks < input_length; ++i)
+                block[i] = a[c + i * blocks];
+            bit_reverse_permutation(block, log_block_size);
+            butterfly_stages(block, block_size, twiddles.data());
+        }
+    });
+
+    a.resize(output_length);
+    parallel_for(output_length, [&](size_t begin, size_t end) {
+        for (uint64_t k = begin; k < end; ++k) {
+            Scalar res = sub_transforms[(blocks - 1) * block_size + k];
+            for (uint64_t c = blocks - 1; c > 0; --c)
+                res = res * powers[k] + sub_transforms[(c - 1) * block_size + k];
+            a[k] = res;
+        }
+    }, 256);
+}
+
+/// Side length of the square tiles used by the cache-blocked transposition.
+const uint64_t TRANSPOSE_TILE_SIZE = 16;
+
+/// Writes the transposition of the rows x cols matrix <tt>src</tt> into <tt>dst</tt>, one tile row per task.
+void transpose(const Scalar *src, Scalar *dst, uint64_t rows, uint64_t cols) {
+    const uint64_t tile_rows = (rows + TRANSPOSE_TILE_SIZE - 1) / TRANSPOSE_TILE_SIZE;
+    parallel_for(tile_rows, [&](size_t begin, size_t end) {
+        for (uint64_t tr = begin * TRANSPOSE_TILE_SIZE; tr < std::min(end * TRANSPOSE_TILE_SIZE, rows);
+             tr += TRANSPOSE_TILE_SIZE)
+            for (uint64_t tc = 0; tc < cols; tc += TRANSPOSE_TILE_SIZE)
+                for (uint64_t r = tr; r < std::min(tr + TRANSPOSE_TILE_SIZE, rows); ++r)
+                    for (uint64_t c = tc; c < std::min(tc + TRANSPOSE_TILE_SIZE, cols); ++c)
+                        dst[c * rows + r] = src[r * cols + c];
+    });
+}
+
+/// Runs an independent transform of size 2 ^ log_size on every row of the matrix starting at a.
+void row_fast_fouriers(Scalar *a, uint64_t rows, uint32_t log_size, const Scalar *twiddles) {
+    const uint64_t cols = static_cast<uint64_t>(1) << log_size;
+    parallel_for(rows, [&](size_t begin, size_t end) {
+        for (size_t row = begin; row < end; ++row) {
+            bit_reverse_permutation(a + row * cols, log_size);
+            butterfly_stages(a + row * cols, cols, twiddles);
+        }
+    });
+}
+
+void six_step_fast_fourier(std::vector<Scalar> &a, const std::vector<Scalar> &twiddles, uint32_t log_size) {
+    const uint64_t n = a.size();
+    assert(n == (static_cast<uint64_t>(1) << log_size));
+    assert(twiddles.size() + 1 == n);
+    if (log_size < 2) {
+        serial_fast_fourier(a, twiddles, log_size);
+        return;
+    }
+
+    // the input is viewed as a matrix of R rows and C columns, a[C * j1 + j2], and the output as X[k1 + R * k2].
+    const uint32_t log_rows = log_size / 2;
+    const uint32_t log_cols = log_size - log_rows;
+    const uint64_t rows = static_cast<uint64_t>(1) << log_rows;
+    const uint64_t cols = static_cast<uint64_t>(1) << log_cols;
+    const uint64_t half = n / 2;
+    const Scalar *powers = twiddles.data() + (half - 1);
+
+    // the scratch matrix comes from the workspace, and the storage of the input is recycled in its place at the end.
+    ScratchBuffer scratch_buffer{acquire_uninitialized(n)};
+    std::vector<Scalar> &scratch = *scratch_buffer;
+
+    // 1. transpose into C rows of length R, and transform each of them.
+    transpose(a.data(), scratch.data(), rows, cols);
+    row_fast_fouriers(scratch.data(), cols, log_rows, twiddles.data());
+
+    // 2. multiply the element (j2, k1) by omega ^ (j2 * k1), looked up from the last stage of the twiddle table.
+    parallel_for(cols, [&](size_t begin, size_t end) {
+        for (uint64_t j2 = begin; j2 < end; ++j2) {
+            uint64_t exponent = 0;
+            for (uint64_t k1 = 1; k1 < rows; ++k1) {
+                exponent = (exponent + j2) & (n - 1);
+                Scalar &element = scratch[j2 * rows + k1];
+                element *= exponent < half ? powers[exponent] : -powers[exponent - half];
+            }
+        }
+    });
+
+    // 3. transpose back into R rows of length C, transform each of them and transpose into the output order.
+    transpose(scratch.data(), a.data(), cols, rows);
+    row_fast_fouriers(a.data(), rows, log_cols, twiddles.data());
+    transpose(a.data(), scratch.data(), rows, cols);
+    a.swap(scratch);
+}
+
+void batch_fast_fourier(std::vector<Scalar> &a, size_t width, const std::vector<Scalar> &twiddles,
+                        uint32_t log_size) {
+    const uint64_t n = static_cast<uint64_t>(1) << log_size;
+    assert(a.size() == n * width);
+    assert(twiddles.size() + 1 == n);
+
+    for (uint64_t k = 0; k < n; ++k) {
+        const uint64_t rk = bit_reverse(static_cast<uint32_t>(k), log_size);
+        if (k < rk) std::swap_ranges(a.begin() + static_cast<long>(k * width),
+                                     a.begin() + static_cast<long>((k + 1) * width),
+                                     a.begin() + static_cast<long>(rk * width));
+    }
+    for (uint64_t m = 1; m < n; m *= 2) {
+        const Scalar *omega_m = twiddles.data() + (m - 1);
+        for (uint64_t k = 0; k < n; k += 2 * m) {
+            for (uint64_t j = 0; j < m; ++j) {
+                const Scalar &omega = omega_m[j];
+                Scalar *x = a.data() + (k + j) * width;
+                Scalar *y = a.data() + (k + j + m) * width;
+                for (size_t c = 0; c < width; ++c) {
+                    const Scalar t = j == 0 ? y[c] : y[c] * omega;
+                    y[c] = x[c] - t;
+                    x[c] += t;
+                }
+            }
+        }
+    }
+}
+
+void radix_3_fast_fourier(std::vector<Scalar> &a, const Scalar &omega, const std::vector<Scalar> &twiddles,
+                          uint32_t log_size) {
+    const uint64_t m = static_cast<uint64_t>(1) << log_size;
+    assert(a.size() == 3 * m);
+
+    std::array<std::vector<Scalar>, 3> parts;
+    for (uint64_t r = 0; r < 3; ++r) {
+        parts[r].reserve(m);
+        for (uint64_t j = 0; j < m; ++j) parts[r].push_back(a[3 * j + r]);
+        best_fast_fourier(parts[r], twiddles, log_size);
+    }
+
+    // X[k + l * m] = F0[k] + omega ^ (k + l * m) * F1[k] + omega ^ (2 * (k + l * m)) * F2[k], and omega ^ m is a
+    // primitive cube root of unity.
+    const Scalar cube_root = omega.pow({m, 0, 0, 0});
+    const Scalar cube_root_square = cube_root.square();
+    parallel_for(m, [&](size_t begin, size_t end) {
+        Scalar omega_k = omega.pow({begin, 0, 0, 0});
+        for (uint64_t k = begin; k < end; ++k) {
+            const Scalar &f0 = parts[0][k];
+            const Scalar t1 = parts[1][k] * omega_k;
+            const Scalar t2 = parts[2][k] * omega_k.square();
+            a[k] = f0 + t1 + t2;
+            a[k + m] = f0 + cube_root * t1 + cube_root_square * t2;
+            a[k + 2 * m] = f0 + cube_root_square * t1 + cube_root * t2;
+            omega_k *= omega;
+        }
+    }, 1024);
+}
+
+void best_fast_fourier(std::vector<Scalar> &a, const std::vector<Scalar> &twiddles, uint32_t log_size) {
+    if (num_threads() <= 1 || log_size < PARALLEL_FOURIER_MIN_LOG_SIZE)
+        serial_fast_fourier(a, twiddles, log_size);
+    else if (log_size >= SIX_STEP_FOURIER_MIN_LOG_SIZE)
+        six_step_fast_fourier(a, twiddles, log_size);
+    else
+        parallel_fast_fourier(a, twiddles, log_size);
+}
+
 } // namespace kzg::domain
\ No newline at end of file
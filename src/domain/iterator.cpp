@@ -1,5 +1,6 @@
 #include "domain/iterator.h"
 
+#include <algorithm>
 #include <utility>
 
 namespace kzg::domain {
@@ -15,9 +16,7 @@ ElementIterator::ElementIterator(EvaluationDomain domain, uint64_t init_power, c
           init_value{init_value} {}
 
 size_t ElementIterator::size() const {
-    size_t size = 0;
-    for (const Scalar &ele: *this) size++;
-    return size;
+    return this->domain.size() - this->init_power;
 }
 
 ElementIterator ElementIterator::begin() const {
@@ -53,4 +52,52 @@ ElementIterator &ElementIterator::operator=(const ElementIterator &rhs) = defaul
 
 ElementIterator &ElementIterator::operator=(ElementIterator &&rhs) noexcept = default;
 
+ElementRange::ElementRange(std::shared_ptr<const std::vector<Scalar>> powers)
+        : powers{std::move(powers)}, first{0}, last{this->powers->size()} {}
+
+ElementRange::ElementRange(std::shared_ptr<const std::vector<Scalar>> powers, size_t first, size_t last)
+        : powers{std::move(powers)}, first{first}, last{last} {
+    assert(first <= last && last <= this->powers->size());
+}
+
+size_t ElementRange::size() const noexcept {
+    return this->last - this->first;
+}
+
+bool ElementRange::empty() const noexcept {
+    return this->first == this->last;
+}
+
+size_t ElementRange::offset() const noexcept {
+    return this->first;
+}
+
+ElementRange::iterator ElementRange::begin() const {
+    return this->powers->begin() + static_cast<long>(this->first);
+}
+
+ElementRange::iterator ElementRange::end() const {
+    return this->powers->begin() + static_cast<long>(this->last);
+}
+
+ElementRange ElementRange::subrange(size_t begin, size_t end) const {
+    assert(begin <= end && end <= this->size());
+    return ElementRange{this->powers, this->first + begin, this->first + end};
+}
+
+std::vector<ElementRange> ElementRange::split(size_t parts) const {
+    assert(parts > 0);
+    parts = std::max<size_t>(std::min(parts, this->size()), 1);
+    std::vector<ElementRange> ranges;
+    ranges.reserve(parts);
+    for (size_t i = 0; i < parts; ++i)
+        ranges.push_back(this->subrange(this->size() * i / parts, this->size() * (i + 1) / parts));
+    return ranges;
+}
+
+const Scalar &ElementRange::operator[](size_t index) const {
+    assert(index < this->size());
+    return (*this->powers)[this->first + index];
+}
+
 } // namespace kzg::domain
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include "domain/quotient.h"
+
+#include <numeric>
+#include <utility>
+
+#include "exception/exception.h"
+#include "domain/extension.h"
+#include "utils/field.h"
+#include "utils/parallel.h"
+
+namespace kzg::domain {
+
+using bls12_381::scalar::Scalar;
+
+using exception::Exception;
+using exception::Type;
+using util::parallel::parallel_for;
+
+/// the minimum number of coefficients handled by one thread in the element-wise loops.
+const size_t QUOTIENT_CHUNK_SIZE = 1024;
+
+std::pair<std::vector<Scalar>, std::vector<Scalar>>
+divide_by_vanishing_polynomial(const EvaluationDomain &domain, const std::vector<Scalar> &coefficients) {
+    const size_t size = domain.size();
+    if (coefficients.size() <= size) {
+        std::vector<Scalar> remainder = coefficients;
+        remainder.resize(size, Scalar::zero());
+        return {{}, std::move(remainder)};
+    }
+
+    // q[i] = p[i + n] + q[i + n], the last row of the quotient being copied from the dividend.
+    const size_t quotient_size = coefficients.size() - size;
+    std::vector<Scalar> quotient(coefficients.begin() + static_cast<long>(size), coefficients.end());
+    for (size_t row = (quotient_size - 1) / size; row > 0; --row) {
+        const size_t begin_index = (row - 1) * size;
+        parallel_for(size, [&](size_t begin, size_t end) {
+            for (size_t j = begin; j < end; ++j)
+                if (begin_index + j + size < quotient_size)
+                    quotient[begin_index + j] += quotient[begin_index + j + size];
+        }, QUOTIENT_CHUNK_SIZE);
+    }
+
+    // p = q * (X ^ n - 1) + r, so r[i] = p[i] + q[i].
+    std::vector<Scalar> remainder(coefficients.begin(), coefficients.begin() + static_cast<long>(size));
+    parallel_for(std::min(size, quotient_size), [&](size_t begin, size_t end) {
+        for (size_t j = begin; j < end; ++j) remainder[j] += quotient[j];
+    }, QUOTIENT_CHUNK_SIZE);
+    return {std::move(quotient), std::move(remainder)};
+}
+
+std::vector<Scalar> vanishing_polynomial_inverses_over_coset(const EvaluationDomain &domain,
+                                                             const EvaluationDomain &coset_domain,
+                                                             const Scalar &shift) {
+    const uint64_t size = domain.size();
+    const uint64_t period = coset_domain.size() / std::gcd(static_cast<uint64_t>(coset_domain.size()), size);
+    const Scalar step = coset_domain.group_generator().pow({size, 0, 0, 0});
+
+    std::vector<Scalar> inverses;
+    inverses.reserve(period);
+    Scalar power = shift.pow({size, 0, 0, 0});
+    for (uint64_t i = 0; i < period; ++i) {
+        const Scalar value = power - Scalar::one();
+        if (value.is_zero())
+            throw Exception(Type::DIVISION_BY_ZERO, "the vanishing polynomial has a root on the coset.");
+        inverses.push_back(value);
+        power *= step;
+    }
+    util::field::batch_inversion(inverses);
+    return inverses;
+}
+
+void divide_by_vanishing_polynomial_over_coset(const EvaluationDomain &domain,
+                                               const EvaluationDomain &coset_domain,
+                                               std::vector<Scalar> &evaluations,
+                                               const Scalar &shift) {
+    if (evaluations.size() != coset_domain.size())
+        throw Exception(Type::SIZE_MISMATCH, "the coset evaluations do not match the domain size.");
+    const auto inverses = vanishing_polynomial_inverses_over_coset(domain, coset_domain, shift);
+    const size_t period = inverses.size();
+    parallel_for(evaluations.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) evaluations[i] *= inverses[i % period];
+    }, QUOTIENT_CHUNK_SIZE);
+}
+
+std::vector<Scalar> quotient_over_coset(const EvaluationDomain &domain,
+                                        const std::vector<Scalar> &coefficients,
+                                        const Scalar &shift) {
+    if (coefficients.size() <= domain.size()) return {};
+
+    const size_t quotient_size = coefficients.size() - domain.size();
+    const auto coset_domain = EvaluationDomain::mixed_radix(quotient_size);
+    auto evaluations = std::move(evaluate_over_cosets(coset_domain, coefficients, {shift})[0]);
+    divide_by_vanishing_polynomial_over_coset(domain, coset_domain, evaluations, shift);
+    coset_domain.coset_inverse_fast_fourier_in_place(evaluations, shift);
+    evaluations.resize(quotient_size);
+    return evaluations;
+}
+
+} // namespace kzg::domain
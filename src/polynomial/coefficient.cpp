@@ -1,19 +1,40 @@
 #include "polynomial/coefficient.h"
 
 #include <cassert>
+#include <algorithm>
 
-#include "utils/field.h"
+#include "utils/parallel.h"
+#include "utils/workspace.h"
 
-#include "domain/domain.h"
+#include "exception/exception.h"
+#include "polynomial/division.h"
 #include "polynomial/evaluation.h"
+#include "polynomial/multiplication.h"
 
 namespace kzg::polynomial {
 
 using bls12_381::scalar::Scalar;
 using rng::core::RngCore;
 
-using domain::EvaluationDomain;
-using util::field::generate_vec_powers;
+using exception::Exception;
+using exception::Type;
+using util::parallel::num_threads;
+using util::parallel::parallel_for;
+using util::workspace::acquire;
+using util::workspace::acquire_uninitialized;
+using util::workspace::recycle;
+using util::workspace::ScratchBuffer;
+
+/// the minimum number of coefficients handled by one thread in Horner's evaluation.
+const size_t HORNER_CHUNK_SIZE = 4096;
+
+/// Evaluates the coefficients in [begin, end) as a polynomial of degree end - begin - 1 with Horner's rule.
+Scalar horner(const std::vector<Scalar> &coefficients, size_t begin, size_t end, const Scalar &point) {
+    Scalar res = Scalar::zero();
+    for (size_t i = end; i > begin; --i)
+        res = res * point + coefficients[i - 1];
+    return res;
+}
 
 CoefficientForm::CoefficientForm() : coefficients{} {}
 
@@ -63,39 +84,90 @@ size_t CoefficientForm::degree() const {
     return this->coefficients.size() - 1;
 }
 
-Scalar CoefficientForm::evaluate(const Scalar &point) const {
-    if (this->is_zero())
-        return Scalar::zero();
-    auto monomials = generate_vec_powers(point, this->degree());
-    assert(monomials.size() == this->coefficients.size());
+/// Number of chunks of Horner's evaluation of <tt>size</tt> coefficients, one per thread and at most one per chunk size.
+size_t horner_chunks(size_t size) {
+    return std::clamp<size_t>(size / HORNER_CHUNK_SIZE, 1, num_threads());
+}
 
+Scalar CoefficientForm::evaluate(const Scalar &point) const {
+    const size_t size = this->coefficients.size();
+    const size_t chunks = horner_chunks(size);
+    if (chunks == 1) return horner(this->coefficients, 0, size, point);
+
+    // each chunk writes its own partial sum into a pooled buffer, and they are added up after the join.
+    const size_t chunk_size = (size + chunks - 1) / chunks;
+    ScratchBuffer partials_buffer{acquire_uninitialized(chunks)};
+    auto &partials = *partials_buffer;
+    parallel_for(chunks, [&](size_t first, size_t last) {
+        for (size_t chunk = first; chunk < last; ++chunk) {
+            const size_t begin = chunk * chunk_size;
+            const size_t end = std::min(size, begin + chunk_size);
+            partials[chunk] = horner(this->coefficients, begin, end, point) * point.pow({begin, 0, 0, 0});
+        }
+    });
     Scalar res = Scalar::zero();
-    for (int i = 0; i < this->coefficients.size(); ++i)
-        res += (this->coefficients[i] * monomials[i]);
+    for (size_t chunk = 0; chunk < chunks; ++chunk) res += partials[chunk];
     return res;
 }
 
+std::vector<Scalar> CoefficientForm::evaluate(std::span<const Scalar> points) const {
+    const size_t size = this->coefficients.size();
+    const size_t chunks = horner_chunks(size);
+    const size_t chunk_size = (size + chunks - 1) / chunks;
+
+    // the partial sums of the c-th chunk at the points are stored at [c * k, (c + 1) * k), and added up after the join.
+    const size_t k = points.size();
+    std::vector<Scalar> partials(chunks * k, Scalar::zero());
+    parallel_for(chunks, [&](size_t first, size_t last) {
+        for (size_t chunk = first; chunk < last; ++chunk) {
+            const size_t begin = chunk * chunk_size;
+            const size_t end = std::min(size, begin + chunk_size);
+            Scalar *partial = partials.data() + chunk * k;
+            for (size_t i = end; i > begin; --i) {
+                const Scalar &coefficient = this->coefficients[i - 1];
+                for (size_t j = 0; j < k; ++j)
+                    partial[j] = partial[j] * points[j] + coefficient;
+            }
+            if (begin != 0)
+                for (size_t j = 0; j < k; ++j) partial[j] *= points[j].pow({begin, 0, 0, 0});
+        }
+    });
+    for (size_t chunk = 1; chunk < chunks; ++chunk)
+        for (size_t j = 0; j < k; ++j) partials[j] += partials[chunk * k + j];
+    partials.resize(k);
+    return partials;
+}
+
 CoefficientForm CoefficientForm::ruffini(const Scalar &point) const {
-    std::vector<Scalar> quotient;
-    quotient.reserve(this->degree());
+    if (this->coefficients.size() <= 1)
+        return CoefficientForm::zero();
+    // q_{i - 1} = c_i + point * q_i, from the leading coefficient down, the remainder is dropped.
+    auto quotient = acquire_uninitialized(this->coefficients.size() - 1);
     Scalar k = Scalar::zero();
-    for (auto iter = this->coefficients.rbegin(); // NOLINT(modernize-loop-convert)
-         iter != this->coefficients.rend(); iter++) {
-        Scalar t = *iter + k;
-        quotient.push_back(t);
-        k = point * t;
-    }
-    if (!quotient.empty()) {
-        quotient.pop_back();
-        std::reverse(quotient.begin(), quotient.end());
+    for (size_t i = quotient.size(); i > 0; --i) {
+        k = this->coefficients[i] + point * k;
+        quotient[i - 1] = k;
     }
-    return CoefficientForm{quotient};
+    return CoefficientForm{std::move(quotient)};
 }
 
-std::vector<Scalar> CoefficientForm::get_coefficients() const {
+std::pair<CoefficientForm, CoefficientForm> CoefficientForm::divide_with_remainder(const CoefficientForm &divisor) const {
+    if (divisor.is_zero())
+        throw Exception(Type::DIVISION_BY_ZERO, "the divisor polynomial is zero.");
+    auto [quotient, remainder] = divide(this->coefficients, divisor.coefficients);
+    return {CoefficientForm{std::move(quotient)}, CoefficientForm{std::move(remainder)}};
+}
+
+const std::vector<Scalar> &CoefficientForm::get_coefficients() const {
     return this->coefficients;
 }
 
+std::vector<Scalar> CoefficientForm::take_coefficients() {
+    std::vector<Scalar> res = std::move(this->coefficients);
+    this->coefficients = std::vector<Scalar>{};
+    return res;
+}
+
 CoefficientForm &CoefficientForm::operator=(CoefficientForm &&rhs) noexcept = default;
 
 CoefficientForm &CoefficientForm::operator=(const CoefficientForm &rhs) = default;
@@ -114,8 +186,9 @@ CoefficientForm &CoefficientForm::operator+=(const CoefficientForm &polynomial)
     } else if (polynomial.is_zero()) {
 
     } else if (this->degree() >= polynomial.degree()) {
-        for (int i = 0; i < this->coefficients.size(); ++i)
+        for (int i = 0; i < polynomial.coefficients.size(); ++i)
             this->coefficients[i] += polynomial.coefficients[i];
+        this->trim_leading_zeros();
     } else {
         this->coefficients.resize(polynomial.coefficients.size(), Scalar::zero());
         for (int i = 0; i < this->coefficients.size(); ++i)
@@ -133,8 +206,9 @@ CoefficientForm &CoefficientForm::operator-=(const CoefficientForm &polynomial)
     } else if (polynomial.is_zero()) {
 
     } else if (this->degree() >= polynomial.degree()) {
-        for (int i = 0; i < this->coefficients.size(); ++i)
+        for (int i = 0; i < polynomial.coefficients.size(); ++i)
             this->coefficients[i] -= polynomial.coefficients[i];
+        this->trim_leading_zeros();
     } else {
         this->coefficients.resize(polynomial.coefficients.size(), Scalar::zero());
         for (int i = 0; i < this->coefficients.size(); ++i)
@@ -149,14 +223,10 @@ CoefficientForm &CoefficientForm::operator*=(const CoefficientForm &polynomial)
         *this = CoefficientForm::zero();
         return *this;
     }
-    auto poly_coefficients = polynomial.coefficients;
-
-    const EvaluationDomain domain{this->coefficients.size() + polynomial.coefficients.size()};
-    EvaluationForm self_evaluations{domain.fast_fourier(this->coefficients), domain};
-    const EvaluationForm poly_evaluations{domain.fast_fourier(poly_coefficients), domain};
-
-    self_evaluations *= poly_evaluations;
-    *this = self_evaluations.interpolate();
+    auto product = multiply(this->coefficients, polynomial.coefficients);
+    recycle(std::move(this->coefficients));
+    this->coefficients = std::move(product);
+    this->trim_leading_zeros();
     return *this;
 }
 
@@ -183,11 +253,8 @@ CoefficientForm &CoefficientForm::operator*=(const Scalar &value) {
         *this = CoefficientForm::zero();
         return *this;
     }
-    std::vector<Scalar> scaled_coeffs;
-    scaled_coeffs.reserve(this->coefficients.size());
-    for (const auto &coefficient: this->coefficients)
-        scaled_coeffs.push_back(coefficient * value);
-    *this = CoefficientForm{scaled_coeffs};
+    for (auto &coefficient: this->coefficients)
+        coefficient *= value;
     return *this;
 }
 
@@ -201,30 +268,40 @@ bls12_381::scalar::Scalar CoefficientForm::operator[](size_t index) const {
     return this->coefficients[index];
 }
 
-std::optional<CoefficientForm> CoefficientForm::from_slice(const std::vector<uint8_t> &bytes) {
+std::optional<CoefficientForm> CoefficientForm::from_slice(std::span<const uint8_t> bytes) {
     const size_t coeff_count = bytes.size() / Scalar::BYTE_SIZE;
     std::vector<Scalar> coeffs;
     coeffs.reserve(coeff_count);
 
-    for (int i = 0; i < bytes.size(); i += Scalar::BYTE_SIZE) {
+    for (size_t i = 0; i < coeff_count * Scalar::BYTE_SIZE; i += Scalar::BYTE_SIZE) {
         std::array<uint8_t, Scalar::BYTE_SIZE> coeff_byte{};
-        std::copy(bytes.begin() + i, bytes.begin() + i + Scalar::BYTE_SIZE, coeff_byte.begin());
+        std::copy_n(bytes.begin() + static_cast<long>(i), Scalar::BYTE_SIZE, coeff_byte.begin());
         const auto scalar_opt = Scalar::from_bytes(coeff_byte);
         if (!scalar_opt.has_value()) return std::nullopt;
         coeffs.push_back(scalar_opt.value());
     }
 
-    return CoefficientForm{coeffs};
+    return CoefficientForm{std::move(coeffs)};
 }
 
 std::vector<uint8_t> CoefficientForm::to_var_bytes() const {
-    std::vector<uint8_t> res{};
-    res.reserve(this->coefficients.size() * Scalar::BYTE_SIZE);
+    std::vector<uint8_t> res(this->var_bytes_size());
+    this->write_var_bytes(res);
+    return res;
+}
+
+size_t CoefficientForm::var_bytes_size() const {
+    return this->coefficients.size() * Scalar::BYTE_SIZE;
+}
+
+void CoefficientForm::write_var_bytes(std::span<uint8_t> buffer) const {
+    if (buffer.size() < this->var_bytes_size())
+        throw Exception(Type::SERIALIZE_NO_ENOUGH_BYTES, "output buffer not long enough.");
+    auto iter = buffer.begin();
     for (const Scalar &coeff: this->coefficients) {
         const std::array<uint8_t, Scalar::BYTE_SIZE> coeff_bytes = coeff.to_bytes();
-        res.insert(res.end(), coeff_bytes.begin(), coeff_bytes.end());
+        iter = std::copy(coeff_bytes.begin(), coeff_bytes.end(), iter);
     }
-    return res;
 }
 
 } // namespace kzg::polynomial
\ No newline at end of file
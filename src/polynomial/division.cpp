@@ -0,0 +1,76 @@
+#include "polynomial/division.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "polynomial/multiplication.h"
+
+namespace kzg::polynomial {
+
+using bls12_381::scalar::Scalar;
+
+std::vector<Scalar> inverse_series(std::span<const Scalar> f, size_t precision) {
+    assert(!f.empty() && !f[0].is_zero());
+    std::vector<Scalar> g = {f[0].invert().value()};
+    g.reserve(precision);
+
+    // f * g = 1 + X ^ l * e modulo X ^ 2l, so the correction only touches the coefficients from l on.
+    for (size_t length = 1; length < precision;) {
+        const size_t next_length = std::min(2 * length, precision);
+        auto h = multiply(f.first(std::min(f.size(), next_length)), g);
+        h.resize(next_length, Scalar::zero());
+        const auto correction = multiply(g, std::span<const Scalar>{h}.subspan(length));
+        g.resize(next_length, Scalar::zero());
+        for (size_t i = length; i < next_length; ++i)
+            g[i] = -correction[i - length];
+        length = next_length;
+    }
+    g.resize(precision, Scalar::zero());
+    return g;
+}
+
+std::pair<std::vector<Scalar>, std::vector<Scalar>> long_divide(std::span<const Scalar> a, std::span<const Scalar> b) {
+    assert(!b.empty() && !b.back().is_zero());
+    if (a.size() < b.size()) return {{}, std::vector<Scalar>(a.begin(), a.end())};
+
+    const Scalar leading_inverse = b.back().invert().value();
+    std::vector<Scalar> remainder(a.begin(), a.end());
+    std::vector<Scalar> quotient(a.size() - b.size() + 1, Scalar::zero());
+    for (size_t i = quotient.size(); i-- > 0;) {
+        const Scalar factor = remainder[i + b.size() - 1] * leading_inverse;
+        quotient[i] = factor;
+        for (size_t j = 0; j < b.size(); ++j)
+            remainder[i + j] -= factor * b[j];
+    }
+    remainder.resize(b.size() - 1);
+    return {quotient, remainder};
+}
+
+std::pair<std::vector<Scalar>, std::vector<Scalar>> newton_divide(std::span<const Scalar> a, std::span<const Scalar> b) {
+    assert(!b.empty() && !b.back().is_zero());
+    if (a.size() < b.size()) return {{}, std::vector<Scalar>(a.begin(), a.end())};
+
+    const size_t quotient_size = a.size() - b.size() + 1;
+    const std::vector<Scalar> reversed_a(a.rbegin(), a.rbegin() + static_cast<long>(quotient_size));
+    const std::vector<Scalar> reversed_b(b.rbegin(), b.rbegin() + static_cast<long>(std::min(b.size(), quotient_size)));
+
+    auto quotient = multiply(reversed_a, inverse_series(reversed_b, quotient_size));
+    quotient.resize(quotient_size);
+    std::reverse(quotient.begin(), quotient.end());
+
+    // only the low m - 1 coefficients of a - q * b may be non-zero.
+    const auto product = multiply(quotient, b);
+    std::vector<Scalar> remainder(a.begin(), a.begin() + static_cast<long>(b.size() - 1));
+    for (size_t i = 0; i < remainder.size(); ++i)
+        remainder[i] -= product[i];
+    return {quotient, remainder};
+}
+
+std::pair<std::vector<Scalar>, std::vector<Scalar>> divide(std::span<const Scalar> a, std::span<const Scalar> b) {
+    if (a.size() < b.size()) return {{}, std::vector<Scalar>(a.begin(), a.end())};
+    if (std::min(b.size(), a.size() - b.size() + 1) <= LONG_DIVISION_MAX_SIZE)
+        return long_divide(a, b);
+    return newton_divide(a, b);
+}
+
+} // namespace kzg::polynomial
@@ -1,11 +1,84 @@
 #include "polynomial/evaluation.h"
 
+#include <algorithm>
 #include <cassert>
+#include <functional>
+#include <mutex>
+
+#include "domain/extension.h"
+#include "exception/exception.h"
+#include "utils/field.h"
+#include "utils/parallel.h"
+#include "utils/workspace.h"
 
 namespace kzg::polynomial {
 
 using bls12_381::scalar::Scalar;
 using domain::EvaluationDomain;
+using exception::Exception;
+using exception::Type;
+using util::parallel::parallel_for;
+using util::workspace::acquire;
+using util::workspace::acquire_uninitialized;
+using util::workspace::ScratchBuffer;
+
+/// the minimum number of evaluations handled by one thread in the barycentric sums.
+const size_t BARYCENTRIC_CHUNK_SIZE = 1024;
+/// the minimum number of evaluations handled by one thread in the pointwise loops.
+const size_t POINTWISE_CHUNK_SIZE = 4096;
+
+/// A sum of fractions kept as a single numerator and denominator, so that it is inverted only once.
+struct Fraction {
+    Scalar numerator = Scalar::zero();
+    Scalar denominator = Scalar::one();
+    /// The evaluation at the point if it lies in the domain, where the barycentric formula does not apply.
+    std::optional<Scalar> hit;
+
+    void add(const Fraction &fraction) {
+        if (fraction.hit.has_value()) this->hit = fraction.hit;
+        this->numerator = this->numerator * fraction.denominator + fraction.numerator * this->denominator;
+        this->denominator *= fraction.denominator;
+    }
+};
+
+/// Combines the degree bounds of two operands, unknown if either of them is.
+template<typename Combine>
+std::optional<size_t> combined_degree_bound(const EvaluationForm &a, const EvaluationForm &b, Combine combine) {
+    const auto bound_a = a.get_degree_bound();
+    const auto bound_b = b.get_degree_bound();
+    if (!bound_a.has_value() || !bound_b.has_value()) return std::nullopt;
+    return combine(bound_a.value(), bound_b.value());
+}
+
+/// Re-evaluates a polynomial onto a larger domain which contains its own one.
+EvaluationForm extended_onto(const EvaluationForm &polynomial, const EvaluationDomain &domain) {
+    const size_t size = polynomial.get_domain().size();
+    if (domain.size() % size != 0)
+        throw Exception(Type::INVALID_EVALUATION_DOMAIN_SIZE, "the evaluation domains are not nested.");
+    auto res = polynomial.extend(domain.size() / size);
+    if (res.get_domain() != domain)
+        throw Exception(Type::INVALID_EVALUATION_DOMAIN_SIZE, "the evaluation domains are not nested.");
+    return res;
+}
+
+/**
+ * Extends both operands onto the smallest common domain holding a polynomial of the given degree, the first one in
+ * place. Returns the extension of the second one, or nothing when it is already over that domain or when the degree
+ * is unknown.
+ */
+std::optional<EvaluationForm> align_domains(EvaluationForm &polynomial, const EvaluationForm &other,
+                                            std::optional<size_t> degree) {
+    if (!degree.has_value()) return std::nullopt;
+    const auto &base = polynomial.get_domain().size() >= other.get_domain().size()
+                       ? polynomial.get_domain() : other.get_domain();
+    size_t blowup = 1;
+    while (base.size() * blowup <= degree.value()) blowup *= 2;
+    const auto target = domain::extended_domain(base, blowup);
+
+    if (polynomial.get_domain() != target) polynomial = extended_onto(polynomial, target);
+    if (other.get_domain() != target) return extended_onto(other, target);
+    return std::nullopt;
+}
 
 EvaluationForm::EvaluationForm(const EvaluationForm &poly) = default;
 
@@ -17,10 +90,108 @@ EvaluationForm::EvaluationForm(const std::vector<Scalar> &evaluations, const Eva
 EvaluationForm::EvaluationForm(std::vector<Scalar> &&evaluations, EvaluationDomain &&domain)
         : evaluations{std::move(evaluations)}, domain{std::move(domain)} {}
 
+EvaluationForm::EvaluationForm(std::vector<Scalar> &&evaluations, EvaluationDomain &&domain, size_t degree_bound)
+        : evaluations{std::move(evaluations)}, domain{std::move(domain)}, degree_bound{degree_bound} {
+    if (this->evaluations.size() != this->domain.size() || degree_bound >= this->domain.size())
+        throw Exception(Type::SIZE_MISMATCH, "the evaluations do not determine a polynomial of the degree bound.");
+}
+
+EvaluationForm EvaluationForm::from_coefficients(const CoefficientForm &polynomial, const EvaluationDomain &domain) {
+    const auto &coefficients = polynomial.get_coefficients();
+    if (coefficients.size() > domain.size())
+        throw Exception(Type::POLY_DEGREE_TOO_LARGE, "the polynomial does not fit in the domain.");
+    auto evaluations = acquire(domain.size());
+    std::copy(coefficients.begin(), coefficients.end(), evaluations.begin());
+    domain.fast_fourier_in_place(evaluations);
+    return EvaluationForm{std::move(evaluations), EvaluationDomain{domain}, polynomial.degree()};
+}
+
+EvaluationForm EvaluationForm::extend(size_t blowup) const {
+    if (this->evaluations.size() != this->domain.size())
+        throw Exception(Type::SIZE_MISMATCH, "the evaluations do not cover the domain.");
+    if (blowup == 1) return *this;
+    auto extended = domain::extended_domain(this->domain, blowup);
+
+    ScratchBuffer coefficients{acquire_uninitialized(this->evaluations.size())};
+    this->interpolate_into(*coefficients);
+    auto shifts = domain::extension_shifts(this->domain, blowup, Scalar::one());
+    shifts.erase(shifts.begin());
+    const auto cosets = domain::evaluate_over_cosets(this->domain, *coefficients, shifts);
+
+    // zeta ^ (i + blowup * j) = zeta ^ i * omega ^ j, the current evaluations are those of the coset i = 0.
+    const size_t size = this->evaluations.size();
+    std::vector<Scalar> res(size * blowup);
+    parallel_for(size, [&](size_t begin, size_t end) {
+        for (size_t j = begin; j < end; ++j) {
+            res[blowup * j] = this->evaluations[j];
+            for (size_t i = 1; i < blowup; ++i)
+                res[i + blowup * j] = cosets[i - 1][j];
+        }
+    }, POINTWISE_CHUNK_SIZE);
+    EvaluationForm polynomial{std::move(res), std::move(extended)};
+    polynomial.degree_bound = this->degree_bound;
+    return polynomial;
+}
+
 CoefficientForm EvaluationForm::interpolate() const {
-    auto temp_eval = this->evaluations;
-    this->domain.inverse_fast_fourier_in_place(temp_eval);
-    return CoefficientForm{evaluations};
+    auto coefficients = acquire_uninitialized(this->evaluations.size());
+    this->interpolate_into(coefficients);
+    return CoefficientForm{std::move(coefficients)};
+}
+
+void EvaluationForm::interpolate_into(std::vector<Scalar> &coefficients) const {
+    coefficients.assign(this->evaluations.begin(), this->evaluations.end());
+    this->domain.inverse_fast_fourier_in_place(coefficients);
+}
+
+Scalar EvaluationForm::evaluate(const Scalar &point) const {
+    return this->evaluate(std::span<const Scalar>{&point, 1})[0];
+}
+
+std::vector<Scalar> EvaluationForm::evaluate(std::span<const Scalar> points) const {
+    assert(this->evaluations.size() == this->domain.size());
+    const Scalar generator = this->domain.group_generator();
+    std::vector<Fraction> sums(points.size());
+    std::mutex sums_mutex;
+
+    // each thread accumulates f_i * omega ^ i / (z - omega ^ i) for every point over its chunk.
+    parallel_for(this->evaluations.size(), [&](size_t begin, size_t end) {
+        std::vector<Fraction> partial(points.size());
+        Scalar element = generator.pow({begin, 0, 0, 0});
+        for (size_t i = begin; i < end; ++i) {
+            const Scalar scaled = this->evaluations[i] * element;
+            for (size_t j = 0; j < points.size(); ++j) {
+                const Scalar difference = points[j] - element;
+                Fraction &fraction = partial[j];
+                if (difference.is_zero()) {
+                    fraction.hit = this->evaluations[i];
+                    continue;
+                }
+                fraction.numerator = fraction.numerator * difference + scaled * fraction.denominator;
+                fraction.denominator *= difference;
+            }
+            element *= generator;
+        }
+        std::lock_guard<std::mutex> lock{sums_mutex};
+        for (size_t j = 0; j < points.size(); ++j) sums[j].add(partial[j]);
+    }, BARYCENTRIC_CHUNK_SIZE);
+
+    std::vector<Scalar> denominators;
+    denominators.reserve(points.size());
+    for (const auto &sum: sums) denominators.push_back(sum.denominator);
+    util::field::batch_inversion(denominators);
+
+    std::vector<Scalar> res;
+    res.reserve(points.size());
+    for (size_t j = 0; j < points.size(); ++j) {
+        if (sums[j].hit.has_value()) {
+            res.push_back(sums[j].hit.value());
+            continue;
+        }
+        const Scalar factor = this->domain.evaluate_vanishing_polynomial(points[j]) * this->domain.size_inverse();
+        res.push_back(factor * sums[j].numerator * denominators[j]);
+    }
+    return res;
 }
 
 EvaluationForm &EvaluationForm::operator=(const EvaluationForm &rhs) = default;
@@ -28,30 +199,51 @@ EvaluationForm &EvaluationForm::operator=(const EvaluationForm &rhs) = default;
 EvaluationForm &EvaluationForm::operator=(EvaluationForm &&rhs) noexcept = default;
 
 EvaluationForm &EvaluationForm::operator+=(const EvaluationForm &polynomial) {
-    assert(this->domain == polynomial.domain);
+    const auto degree = combined_degree_bound(*this, polynomial, [](size_t a, size_t b) { return std::max(a, b); });
+    const auto extended = align_domains(*this, polynomial, degree);
+    const EvaluationForm &other = extended.has_value() ? extended.value() : polynomial;
+    assert(this->domain == other.domain);
     for (int i = 0; i < this->evaluations.size(); ++i)
-        this->evaluations[i] += polynomial.evaluations[i];
+        this->evaluations[i] += other.evaluations[i];
+    this->degree_bound = degree;
     return *this;
 }
 
 EvaluationForm &EvaluationForm::operator-=(const EvaluationForm &polynomial) {
-    assert(this->domain == polynomial.domain);
+    const auto degree = combined_degree_bound(*this, polynomial, [](size_t a, size_t b) { return std::max(a, b); });
+    const auto extended = align_domains(*this, polynomial, degree);
+    const EvaluationForm &other = extended.has_value() ? extended.value() : polynomial;
+    assert(this->domain == other.domain);
     for (int i = 0; i < this->evaluations.size(); ++i)
-        this->evaluations[i] -= polynomial.evaluations[i];
+        this->evaluations[i] -= other.evaluations[i];
+    this->degree_bound = degree;
     return *this;
 }
 
 EvaluationForm &EvaluationForm::operator*=(const EvaluationForm &polynomial) {
-    assert(this->domain == polynomial.domain);
+    const auto degree = combined_degree_bound(*this, polynomial, std::plus<>{});
+    const auto extended = align_domains(*this, polynomial, degree);
+    const EvaluationForm &other = extended.has_value() ? extended.value() : polynomial;
+    assert(this->domain == other.domain);
     for (int i = 0; i < this->evaluations.size(); ++i)
-        this->evaluations[i] *= polynomial.evaluations[i];
+        this->evaluations[i] *= other.evaluations[i];
+    this->degree_bound = degree;
     return *this;
 }
 
 EvaluationForm &EvaluationForm::operator/=(const EvaluationForm &polynomial) {
     assert(this->domain == polynomial.domain);
-    for (int i = 0; i < this->evaluations.size(); ++i)
-        this->evaluations[i] *= polynomial.evaluations[i].invert().value();
+    ScratchBuffer inverses_buffer{acquire_uninitialized(polynomial.evaluations.size())};
+    auto &inverses = *inverses_buffer;
+    std::copy(polynomial.evaluations.begin(), polynomial.evaluations.end(), inverses.begin());
+    for (const Scalar &inverse: inverses)
+        if (inverse.is_zero())
+            throw Exception(Type::DIVISION_BY_ZERO, "the divisor polynomial has a zero evaluation.");
+    util::field::batch_inversion(inverses);
+    parallel_for(this->evaluations.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) this->evaluations[i] *= inverses[i];
+    }, POINTWISE_CHUNK_SIZE);
+    this->degree_bound.reset();
     return *this;
 }
 
@@ -73,42 +265,55 @@ const EvaluationDomain &EvaluationForm::get_domain() const {
     return this->domain;
 }
 
-std::optional<EvaluationForm> EvaluationForm::from_slice(const std::vector<uint8_t> &bytes) {
+std::optional<size_t> EvaluationForm::get_degree_bound() const {
+    return this->degree_bound;
+}
+
+std::optional<EvaluationForm> EvaluationForm::from_slice(std::span<const uint8_t> bytes) {
+    if (bytes.size() < EvaluationDomain::BYTE_SIZE) return std::nullopt;
     std::array<uint8_t, EvaluationDomain::BYTE_SIZE> domain_bytes{};
 
     const size_t eval_count = (bytes.size() - EvaluationDomain::BYTE_SIZE) / Scalar::BYTE_SIZE;
     std::vector<Scalar> evals;
     evals.reserve(eval_count);
 
-    for (int i = 0; i < bytes.size() - EvaluationDomain::BYTE_SIZE; i += Scalar::BYTE_SIZE) {
+    for (size_t i = 0; i < eval_count * Scalar::BYTE_SIZE; i += Scalar::BYTE_SIZE) {
         std::array<uint8_t, Scalar::BYTE_SIZE> eval_byte{};
-        std::copy(bytes.begin() + i, bytes.begin() + i + Scalar::BYTE_SIZE, eval_byte.begin());
+        std::copy_n(bytes.begin() + static_cast<long>(i), Scalar::BYTE_SIZE, eval_byte.begin());
         const auto scalar_opt = Scalar::from_bytes(eval_byte);
         if (!scalar_opt.has_value())
             return std::nullopt;
         evals.push_back(scalar_opt.value());
     }
 
-    std::copy(bytes.begin() + static_cast<uint32_t>(eval_count) * Scalar::BYTE_SIZE, bytes.end(), domain_bytes.begin());
-    const auto domain_opt = EvaluationDomain::from_bytes(domain_bytes);
+    std::copy_n(bytes.end() - EvaluationDomain::BYTE_SIZE, EvaluationDomain::BYTE_SIZE, domain_bytes.begin());
+    auto domain_opt = EvaluationDomain::from_bytes(domain_bytes);
     if (!domain_opt.has_value()) return std::nullopt;
 
-    return EvaluationForm{evals, domain_opt.value()};
+    return EvaluationForm{std::move(evals), std::move(domain_opt.value())};
 }
 
 std::vector<uint8_t> EvaluationForm::to_var_bytes() const {
-    std::vector<uint8_t> res{};
-    res.reserve(EvaluationDomain::BYTE_SIZE + this->evaluations.size() * Scalar::BYTE_SIZE);
+    std::vector<uint8_t> res(this->var_bytes_size());
+    this->write_var_bytes(res);
+    return res;
+}
+
+size_t EvaluationForm::var_bytes_size() const {
+    return this->evaluations.size() * Scalar::BYTE_SIZE + EvaluationDomain::BYTE_SIZE;
+}
 
+void EvaluationForm::write_var_bytes(std::span<uint8_t> buffer) const {
+    if (buffer.size() < this->var_bytes_size())
+        throw Exception(Type::SERIALIZE_NO_ENOUGH_BYTES, "output buffer not long enough.");
+    auto iter = buffer.begin();
     for (const Scalar &eval: this->evaluations) {
         const std::array<uint8_t, Scalar::BYTE_SIZE> eval_bytes = eval.to_bytes();
-        res.insert(res.end(), eval_bytes.begin(), eval_bytes.end());
+        iter = std::copy(eval_bytes.begin(), eval_bytes.end(), iter);
     }
 
     const std::array<uint8_t, EvaluationDomain::BYTE_SIZE> domain_bytes = this->domain.to_bytes();
-    res.insert(res.end(), domain_bytes.begin(), domain_bytes.end());
-
-    return res;
+    std::copy(domain_bytes.begin(), domain_bytes.end(), iter);
 }
 
 } // namespace kzg::polynomial
\ No newline at end of file
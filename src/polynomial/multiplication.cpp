@@ -0,0 +1,147 @@
+#include "polynomial/multiplication.h"
+
+#include <algorithm>
+
+#include "domain/domain.h"
+#include "utils/workspace.h"
+
+namespace kzg::polynomial {
+
+using bls12_381::scalar::Scalar;
+
+using domain::EvaluationDomain;
+using util::workspace::acquire;
+using util::workspace::acquire_uninitialized;
+using util::workspace::ScratchBuffer;
+
+/// Adds the coefficients of <tt>part</tt> to those of <tt>res</tt> from the given offset.
+void add_at(std::vector<Scalar> &res, const std::vector<Scalar> &part, size_t offset) {
+    for (size_t i = 0; i < part.size(); ++i)
+        res[offset + i] += part[i];
+}
+
+/// Adds two coefficient slices of possibly different lengths.
+std::vector<Scalar> add_slices(std::span<const Scalar> a, std::span<const Scalar> b) {
+    auto res = acquire(std::max(a.size(), b.size()));
+    for (size_t i = 0; i < a.size(); ++i) res[i] += a[i];
+    for (size_t i = 0; i < b.size(); ++i) res[i] += b[i];
+    return res;
+}
+
+std::vector<Scalar> schoolbook_multiply(std::span<const Scalar> a, std::span<const Scalar> b) {
+    if (a.empty() || b.empty()) return {};
+    auto res = acquire(a.size() + b.size() - 1);
+    for (size_t i = 0; i < a.size(); ++i)
+        for (size_t j = 0; j < b.size(); ++j)
+            res[i + j] += a[i] * b[j];
+    return res;
+}
+
+std::vector<Scalar> karatsuba_multiply(std::span<const Scalar> a, std::span<const Scalar> b) {
+    if (a.empty() || b.empty()) return {};
+    const size_t half = (std::max(a.size(), b.size()) + 1) / 2;
+    if (std::min(a.size(), b.size()) <= half) {
+        // one operand does not reach the split point, only the other one is split.
+        const auto large = a.size() >= b.size() ? a : b;
+        const auto small = a.size() >= b.size() ? b : a;
+        auto res = acquire(a.size() + b.size() - 1);
+        add_at(res, *ScratchBuffer{multiply(large.first(half), small)}, 0);
+        add_at(res, *ScratchBuffer{multiply(large.subspan(half), small)}, half);
+        return res;
+    }
+
+    // a * b = z0 + (z1 - z0 - z2) * X ^ h + z2 * X ^ 2h, with z1 = (a0 + a1) * (b0 + b1).
+    const auto a0 = a.first(half), a1 = a.subspan(half);
+    const auto b0 = b.first(half), b1 = b.subspan(half);
+    const ScratchBuffer z0{multiply(a0, b0)};
+    const ScratchBuffer z2{multiply(a1, b1)};
+    const ScratchBuffer a_sum{add_slices(a0, a1)}, b_sum{add_slices(b0, b1)};
+    ScratchBuffer z1{multiply(*a_sum, *b_sum)};
+    for (size_t i = 0; i < z0->size(); ++i) (*z1)[i] -= (*z0)[i];
+    for (size_t i = 0; i < z2->size(); ++i) (*z1)[i] -= (*z2)[i];
+
+    auto res = acquire(a.size() + b.size() - 1);
+    add_at(res, *z0, 0);
+    add_at(res, *z2, 2 * half);
+    // the high coefficients of z1 are zero, and may lie past the end of the product.
+    for (size_t i = 0; i < z1->size() && half + i < res.size(); ++i)
+        res[half + i] += (*z1)[i];
+    return res;
+}
+
+std::vector<Scalar> fourier_multiply(std::span<const Scalar> a, std::span<const Scalar> b) {
+    if (a.empty() || b.empty()) return {};
+    // a domain of size 3 * 2 ^ k is used when it is smaller than the next power of 2. Over a power of 2 domain, the
+    // evaluations stay in bit-reversed order, since only their pointwise product is needed, and the transforms skip
+    // the zero padding of the operands and the coefficients past the degree of the product.
+    const size_t product_length = a.size() + b.size() - 1;
+    const auto domain = EvaluationDomain::mixed_radix(product_length);
+
+    // the buffers are taken at the size of the domain, so that the transforms do not grow them.
+    auto a_values = acquire_uninitialized(domain.size());
+    ScratchBuffer b_buffer{acquire_uninitialized(domain.size())};
+    auto &b_values = *b_buffer;
+    a_values.assign(a.begin(), a.end());
+    b_values.assign(b.begin(), b.end());
+    if (domain.is_radix_2()) {
+        domain.fast_fourier_bit_reversed_pruned_in_place(a_values);
+        domain.fast_fourier_bit_reversed_pruned_in_place(b_values);
+    } else {
+        domain.fast_fourier_in_place(a_values);
+        domain.fast_fourier_in_place(b_values);
+    }
+    for (size_t i = 0; i < a_values.size(); ++i)
+        a_values[i] *= b_values[i];
+    if (domain.is_radix_2()) {
+        domain.inverse_fast_fourier_bit_reversed_pruned_in_place(a_values, product_length);
+    } else {
+        domain.inverse_fast_fourier_in_place(a_values);
+        a_values.resize(product_length);
+    }
+    return a_values;
+}
+
+std::vector<Scalar> unbalanced_multiply(std::span<const Scalar> large, std::span<const Scalar> small) {
+    if (large.empty() || small.empty()) return {};
+    auto res = acquire(large.size() + small.size() - 1);
+    if (small.size() <= KARATSUBA_MULTIPLICATION_MAX_SIZE) {
+        for (size_t offset = 0; offset < large.size(); offset += small.size()) {
+            const auto chunk = large.subspan(offset, std::min(small.size(), large.size() - offset));
+            add_at(res, *ScratchBuffer{multiply(chunk, small)}, offset);
+        }
+        return res;
+    }
+
+    const EvaluationDomain domain{2 * small.size() - 1};
+    const size_t chunk_size = domain.size() - small.size() + 1;
+    ScratchBuffer small_buffer{acquire_uninitialized(domain.size())};
+    ScratchBuffer chunk_buffer{acquire_uninitialized(domain.size())};
+    auto &small_values = *small_buffer;
+    auto &values = *chunk_buffer;
+    small_values.assign(small.begin(), small.end());
+    domain.fast_fourier_bit_reversed_pruned_in_place(small_values);
+    for (size_t offset = 0; offset < large.size(); offset += chunk_size) {
+        const auto chunk = large.subspan(offset, std::min(chunk_size, large.size() - offset));
+        values.assign(chunk.begin(), chunk.end());
+        domain.fast_fourier_bit_reversed_pruned_in_place(values);
+        for (size_t i = 0; i < values.size(); ++i)
+            values[i] *= small_values[i];
+        domain.inverse_fast_fourier_bit_reversed_pruned_in_place(values, chunk.size() + small.size() - 1);
+        add_at(res, values, offset);
+    }
+    return res;
+}
+
+std::vector<Scalar> multiply(std::span<const Scalar> a, std::span<const Scalar> b) {
+    const size_t small = std::min(a.size(), b.size());
+    const size_t large = std::max(a.size(), b.size());
+    if (small <= SCHOOLBOOK_MULTIPLICATION_MAX_SIZE)
+        return schoolbook_multiply(a, b);
+    if (large >= UNBALANCED_MULTIPLICATION_RATIO * small)
+        return a.size() >= b.size() ? unbalanced_multiply(a, b) : unbalanced_multiply(b, a);
+    if (small <= KARATSUBA_MULTIPLICATION_MAX_SIZE)
+        return karatsuba_multiply(a, b);
+    return fourier_multiply(a, b);
+}
+
+} // namespace kzg::polynomial
@@ -0,0 +1,195 @@
+#include "polynomial/sparse.h"
+
+#include <algorithm>
+
+#include "exception/exception.h"
+#include "utils/parallel.h"
+#include "utils/workspace.h"
+
+namespace kzg::polynomial {
+
+using bls12_381::scalar::Scalar;
+
+using exception::Exception;
+using exception::Type;
+using util::parallel::parallel_for;
+using util::workspace::acquire;
+using util::workspace::acquire_uninitialized;
+
+/// the minimum number of product coefficients computed by one thread in the sparse-dense multiplication.
+const size_t SPARSE_MULTIPLICATION_CHUNK_SIZE = 4096;
+
+/// Sorts the terms by degree, sums the terms of a same degree and drops the zero ones.
+void normalize(std::vector<std::pair<size_t, Scalar>> &terms) {
+    std::stable_sort(terms.begin(), terms.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+    size_t length = 0;
+    for (size_t i = 0; i < terms.size(); ++i) {
+        if (length != 0 && terms[length - 1].first == terms[i].first)
+            terms[length - 1].second += terms[i].second;
+        else
+            terms[length++] = terms[i];
+        if (terms[length - 1].second.is_zero()) --length;
+    }
+    terms.resize(length);
+}
+
+SparseCoefficientForm::SparseCoefficientForm() : terms{} {}
+
+SparseCoefficientForm::SparseCoefficientForm(std::vector<std::pair<size_t, Scalar>> terms) : terms{std::move(terms)} {
+    normalize(this->terms);
+}
+
+SparseCoefficientForm SparseCoefficientForm::zero() {
+    return SparseCoefficientForm{};
+}
+
+SparseCoefficientForm SparseCoefficientForm::vanishing_polynomial(size_t size) {
+    return SparseCoefficientForm{{{0, -Scalar::one()}, {size, Scalar::one()}}};
+}
+
+SparseCoefficientForm SparseCoefficientForm::from_dense(const CoefficientForm &polynomial) {
+    const auto &coefficients = polynomial.get_coefficients();
+    SparseCoefficientForm res;
+    for (size_t i = 0; i < coefficients.size(); ++i)
+        if (!coefficients[i].is_zero())
+            res.terms.emplace_back(i, coefficients[i]);
+    return res;
+}
+
+CoefficientForm SparseCoefficientForm::to_dense() const {
+    if (this->is_zero()) return CoefficientForm::zero();
+    auto coefficients = acquire(this->degree() + 1);
+    for (const auto &[degree, coefficient]: this->terms)
+        coefficients[degree] = coefficient;
+    return CoefficientForm{std::move(coefficients)};
+}
+
+bool SparseCoefficientForm::is_zero() const {
+    return this->terms.empty();
+}
+
+size_t SparseCoefficientForm::degree() const {
+    return this->terms.empty() ? 0 : this->terms.back().first;
+}
+
+const std::vector<std::pair<size_t, Scalar>> &SparseCoefficientForm::get_terms() const {
+    return this->terms;
+}
+
+Scalar SparseCoefficientForm::evaluate(const Scalar &point) const {
+    Scalar res = Scalar::zero();
+    Scalar power = Scalar::one();
+    size_t previous = 0;
+    for (const auto &[degree, coefficient]: this->terms) {
+        power *= point.pow({degree - previous, 0, 0, 0});
+        res += coefficient * power;
+        previous = degree;
+    }
+    return res;
+}
+
+CoefficientForm SparseCoefficientForm::ruffini(const Scalar &point) const {
+    if (this->degree() == 0) return CoefficientForm::zero();
+    // q_{j - 1} = c_j + point * q_j, from the leading coefficient down, where most of the c_j are zero.
+    auto quotient = acquire_uninitialized(this->degree());
+    auto term = this->terms.rbegin();
+    Scalar k = Scalar::zero();
+    for (size_t j = quotient.size(); j > 0; --j) {
+        if (term != this->terms.rend() && term->first == j) {
+            k += term->second;
+            ++term;
+        }
+        quotient[j - 1] = k;
+        k *= point;
+    }
+    return CoefficientForm{std::move(quotient)};
+}
+
+CoefficientForm SparseCoefficientForm::multiply(const CoefficientForm &polynomial) const {
+    if (this->is_zero() || polynomial.is_zero()) return CoefficientForm::zero();
+    const auto &coefficients = polynomial.get_coefficients();
+    auto res = acquire(coefficients.size() + this->degree());
+
+    // each thread computes a range of the product, so that no coefficient is written by two threads.
+    parallel_for(res.size(), [&](size_t begin, size_t end) {
+        for (const auto &[degree, coefficient]: this->terms) {
+            const size_t first = std::max(begin, degree);
+            const size_t last = std::min(end, degree + coefficients.size());
+            for (size_t i = first; i < last; ++i)
+                res[i] += coefficient * coefficients[i - degree];
+        }
+    }, SPARSE_MULTIPLICATION_CHUNK_SIZE);
+    return CoefficientForm{std::move(res)};
+}
+
+CoefficientForm SparseCoefficientForm::add(const CoefficientForm &polynomial) const {
+    const auto &coefficients = polynomial.get_coefficients();
+    auto res = acquire(std::max(coefficients.size(), this->is_zero() ? 0 : this->degree() + 1));
+    std::copy(coefficients.begin(), coefficients.end(), res.begin());
+    for (const auto &[degree, coefficient]: this->terms)
+        res[degree] += coefficient;
+    return CoefficientForm{std::move(res)};
+}
+
+std::pair<CoefficientForm, CoefficientForm> SparseCoefficientForm::divide(const CoefficientForm &dividend) const {
+    if (this->is_zero())
+        throw Exception(Type::DIVISION_BY_ZERO, "the divisor polynomial is zero.");
+    const auto &coefficients = dividend.get_coefficients();
+    const size_t divisor_degree = this->degree();
+    if (coefficients.size() <= divisor_degree)
+        return {CoefficientForm::zero(), dividend};
+
+    const Scalar leading_inverse = this->terms.back().second.invert().value();
+    auto remainder = acquire_uninitialized(coefficients.size());
+    std::copy(coefficients.begin(), coefficients.end(), remainder.begin());
+    auto quotient = acquire_uninitialized(coefficients.size() - divisor_degree);
+    for (size_t k = coefficients.size(); k > divisor_degree; --k) {
+        const size_t shift = k - 1 - divisor_degree;
+        const Scalar factor = remainder[k - 1] * leading_inverse;
+        quotient[shift] = factor;
+        for (size_t i = 0; i + 1 < this->terms.size(); ++i)
+            remainder[shift + this->terms[i].first] -= factor * this->terms[i].second;
+    }
+    remainder.resize(divisor_degree);
+    return {CoefficientForm{std::move(quotient)}, CoefficientForm{std::move(remainder)}};
+}
+
+SparseCoefficientForm SparseCoefficientForm::operator-() const {
+    SparseCoefficientForm res{*this};
+    for (auto &term: res.terms)
+        term.second = -term.second;
+    return res;
+}
+
+SparseCoefficientForm &SparseCoefficientForm::operator+=(const SparseCoefficientForm &polynomial) {
+    this->terms.insert(this->terms.end(), polynomial.terms.begin(), polynomial.terms.end());
+    normalize(this->terms);
+    return *this;
+}
+
+SparseCoefficientForm &SparseCoefficientForm::operator-=(const SparseCoefficientForm &polynomial) {
+    return *this += -polynomial;
+}
+
+SparseCoefficientForm &SparseCoefficientForm::operator*=(const SparseCoefficientForm &polynomial) {
+    std::vector<std::pair<size_t, Scalar>> product;
+    product.reserve(this->terms.size() * polynomial.terms.size());
+    for (const auto &[degree_a, coefficient_a]: this->terms)
+        for (const auto &[degree_b, coefficient_b]: polynomial.terms)
+            product.emplace_back(degree_a + degree_b, coefficient_a * coefficient_b);
+    normalize(product);
+    this->terms = std::move(product);
+    return *this;
+}
+
+SparseCoefficientForm &SparseCoefficientForm::operator*=(const Scalar &value) {
+    if (value.is_zero()) {
+        this->terms.clear();
+        return *this;
+    }
+    for (auto &term: this->terms)
+        term.second *= value;
+    return *this;
+}
+
+} // namespace kzg::polynomial
@@ -0,0 +1,143 @@
+#include "polynomial/subproduct_tree.h"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+#include "exception/exception.h"
+#include "polynomial/division.h"
+#include "polynomial/multiplication.h"
+#include "utils/field.h"
+#include "utils/parallel.h"
+
+namespace kzg::polynomial {
+
+using bls12_381::scalar::Scalar;
+
+using exception::Exception;
+using exception::Type;
+using util::parallel::num_threads;
+using util::parallel::parallel_for;
+
+struct InterpolationWeights {
+    std::once_flag flag;
+    std::vector<Scalar> weights;
+};
+
+/**
+ * Runs task(begin, end) over the nodes of a level. Levels with at least as many nodes as threads are split among the
+ * threads, and the products of each node run serially inside its chunk. The few nodes near the root are visited one
+ * after the other instead, so that their large products and divisions get all the threads.
+ */
+template<typename Task>
+void for_each_node(size_t count, Task &&task) {
+    if (count >= num_threads()) parallel_for(count, task);
+    else task(0, count);
+}
+
+SubproductTree::SubproductTree(const SubproductTree &tree) = default;
+
+SubproductTree::SubproductTree(SubproductTree &&tree) noexcept = default;
+
+SubproductTree::SubproductTree(std::vector<Scalar> points)
+        : points{std::move(points)}, levels{}, weights{std::make_shared<InterpolationWeights>()} {
+    if (this->points.empty())
+        throw Exception(Type::SIZE_MISMATCH, "the subproduct tree needs at least one point.");
+
+    std::vector<std::vector<Scalar>> leaves;
+    leaves.reserve(this->points.size());
+    for (const auto &point: this->points) leaves.push_back({-point, Scalar::one()});
+    this->levels.push_back(std::move(leaves));
+
+    while (this->levels.back().size() > 1) {
+        const auto &children = this->levels.back();
+        std::vector<std::vector<Scalar>> parents((children.size() + 1) / 2);
+        for_each_node(parents.size(), [&](size_t begin, size_t end) {
+            for (size_t j = begin; j < end; ++j)
+                parents[j] = 2 * j + 1 < children.size() ? multiply(children[2 * j], children[2 * j + 1])
+                                                         : children[2 * j];
+        });
+        this->levels.push_back(std::move(parents));
+    }
+}
+
+const std::vector<Scalar> &SubproductTree::get_points() const {
+    return this->points;
+}
+
+CoefficientForm SubproductTree::get_root() const {
+    return CoefficientForm{this->levels.back()[0]};
+}
+
+std::vector<Scalar> SubproductTree::evaluate(const CoefficientForm &polynomial) const {
+    std::vector<std::vector<Scalar>> remainders = {
+            divide(polynomial.get_coefficients(), this->levels.back()[0]).second
+    };
+    for (size_t level = this->levels.size() - 1; level-- > 0;) {
+        const auto &nodes = this->levels[level];
+        std::vector<std::vector<Scalar>> next(nodes.size());
+        for_each_node(nodes.size(), [&](size_t begin, size_t end) {
+            for (size_t j = begin; j < end; ++j)
+                next[j] = divide(remainders[j / 2], nodes[j]).second;
+        });
+        remainders = std::move(next);
+    }
+
+    // the remainders modulo the linear leaves are the constants p(x_i).
+    std::vector<Scalar> res;
+    res.reserve(remainders.size());
+    for (const auto &remainder: remainders)
+        res.push_back(remainder.empty() ? Scalar::zero() : remainder[0]);
+    return res;
+}
+
+CoefficientForm SubproductTree::interpolate(const std::vector<Scalar> &values) const {
+    if (values.size() != this->points.size())
+        throw Exception(Type::SIZE_MISMATCH, "the number of values is different from the number of points.");
+
+    std::call_once(this->weights->flag, [this] {
+        // M'(x_i) is non-zero if and only if the points are distinct.
+        const auto &root = this->levels.back()[0];
+        std::vector<Scalar> derivative;
+        derivative.reserve(root.size() - 1);
+        for (size_t i = 1; i < root.size(); ++i) derivative.push_back(root[i] * Scalar{i});
+        auto derivative_values = this->evaluate(CoefficientForm{std::move(derivative)});
+        for (const auto &value: derivative_values)
+            if (value.is_zero())
+                throw Exception(Type::DIVISION_BY_ZERO, "the interpolation points are not distinct.");
+        util::field::batch_inversion(derivative_values);
+        this->weights->weights = std::move(derivative_values);
+    });
+
+    std::vector<std::vector<Scalar>> partials;
+    partials.reserve(values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+        partials.push_back({values[i] * this->weights->weights[i]});
+
+    // the partial sum of a node is combined from its children as left * M_right + right * M_left.
+    for (size_t level = 0; level + 1 < this->levels.size(); ++level) {
+        const auto &nodes = this->levels[level];
+        std::vector<std::vector<Scalar>> next((nodes.size() + 1) / 2);
+        for_each_node(next.size(), [&](size_t begin, size_t end) {
+            for (size_t j = begin; j < end; ++j) {
+                if (2 * j + 1 >= nodes.size()) {
+                    next[j] = std::move(partials[2 * j]);
+                    continue;
+                }
+                auto left = multiply(partials[2 * j], nodes[2 * j + 1]);
+                const auto right = multiply(partials[2 * j + 1], nodes[2 * j]);
+                left.resize(std::max(left.size(), right.size()), Scalar::zero());
+                for (size_t i = 0; i < right.size(); ++i) left[i] += right[i];
+                next[j] = std::move(left);
+            }
+        });
+        partials = std::move(next);
+    }
+    return CoefficientForm{std::move(partials[0])};
+}
+
+SubproductTree &SubproductTree::operator=(const SubproductTree &rhs) = default;
+
+SubproductTree &SubproductTree::operator=(SubproductTree &&rhs) noexcept = default;
+
+} // namespace kzg::polynomial
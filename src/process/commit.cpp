@@ -6,13 +6,14 @@ namespace kzg::process::commit {
 
 using bls12_381::group::G1Projective;
 using polynomial::CoefficientForm;
+using polynomial::SparseCoefficientForm;
 using structure::Commitment;
 
 structure::Commitment commit(const structure::CommitKey &commit_key, const CoefficientForm &polynomial) {
     commit_key.check_polynomial_degree(polynomial);
 
-    const auto coefficients = polynomial.get_coefficients();
-    const auto &vec = commit_key.get_powers_of_g();
+    const auto &coefficients = polynomial.get_coefficients();
+    const auto vec = commit_key.get_powers_of_g_view();
 
     G1Projective res{};
     for (int i = 0; i < coefficients.size(); ++i)
@@ -21,4 +22,16 @@ structure::Commitment commit(const structure::CommitKey &commit_key, const Coeff
     return Commitment{res};
 }
 
+structure::Commitment commit(const structure::CommitKey &commit_key, const SparseCoefficientForm &polynomial) {
+    commit_key.check_polynomial_degree(polynomial);
+
+    const auto vec = commit_key.get_powers_of_g_view();
+
+    G1Projective res{};
+    for (const auto &[degree, coefficient]: polynomial.get_terms())
+        res += vec[degree] * coefficient;
+
+    return Commitment{res};
+}
+
 } // namespace kzg::process::commit
\ No newline at end of file
@@ -1,25 +1,40 @@
 #include "process/evaluate.h"
 
+#include <algorithm>
 #include <cassert>
 #include <vector>
 
 #include "process/commit.h"
 #include "utils/field.h"
+#include "utils/workspace.h"
 
 namespace kzg::process::evaluate {
 
 using bls12_381::scalar::Scalar;
 using polynomial::CoefficientForm;
+using polynomial::SparseCoefficientForm;
 using structure::CommitKey;
 using structure::Proof;
 using structure::AggregatedProof;
+using util::workspace::acquire;
+using util::workspace::recycle;
 
 auto create_witness_single(const CommitKey &commit_key, const CoefficientForm &polynomial, const Scalar &point)
 -> Proof {
     const auto evaluation = polynomial.evaluate(point);
-    const auto diff = polynomial - evaluation;
-    const auto quotient = diff.ruffini(point);
+    // the constant term only changes the dropped remainder, so p(X) - p(z) has the same quotient as p(X).
+    auto quotient = polynomial.ruffini(point);
     auto witness = commit::commit(commit_key, quotient);
+    recycle(quotient.take_coefficients());
+    return Proof{point, evaluation, witness};
+}
+
+auto create_witness_single(const CommitKey &commit_key, const SparseCoefficientForm &polynomial, const Scalar &point)
+-> Proof {
+    const auto evaluation = polynomial.evaluate(point);
+    auto quotient = polynomial.ruffini(point);
+    auto witness = commit::commit(commit_key, quotient);
+    recycle(quotient.take_coefficients());
     return Proof{point, evaluation, witness};
 }
 
@@ -38,12 +53,22 @@ auto create_witness_multiple_polynomials(
     for (const auto &polynomial: polynomials)
         evaluations.push_back(polynomial.evaluate(point));
 
-    CoefficientForm psi_poly_numerator{};
-    for (int i = 0; i < polynomials.size(); ++i)
-        psi_poly_numerator += polynomials[i] * gamma_powers[i];
+    // the numerator is accumulated in place in a pooled buffer, instead of through a scaled copy per polynomial.
+    size_t numerator_size = 0;
+    for (const auto &polynomial: polynomials)
+        numerator_size = std::max(numerator_size, polynomial.get_coefficients().size());
+    auto numerator = acquire(numerator_size);
+    for (int i = 0; i < polynomials.size(); ++i) {
+        const auto &coefficients = polynomials[i].get_coefficients();
+        for (size_t j = 0; j < coefficients.size(); ++j)
+            numerator[j] += coefficients[j] * gamma_powers[i];
+    }
+    CoefficientForm psi_poly_numerator{std::move(numerator)};
 
-    const auto quotient = psi_poly_numerator.ruffini(point);
+    auto quotient = psi_poly_numerator.ruffini(point);
     const auto witness = commit::commit(commit_key, quotient);
+    recycle(quotient.take_coefficients());
+    recycle(psi_poly_numerator.take_coefficients());
 
     return AggregatedProof{point, evaluations, witness};
 }
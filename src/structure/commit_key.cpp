@@ -1,8 +1,13 @@
 #include "structure/commit_key.h"
 
+#include <atomic>
+#include <cassert>
+#include <utility>
+
 #include "utils/bit.h"
 
 #include "exception/exception.h"
+#include "utils/parallel.h"
 
 namespace kzg::structure {
 
@@ -13,11 +18,28 @@ using bls12_381::group::G1Affine;
 using exception::Exception;
 using exception::Type;
 using polynomial::CoefficientForm;
+using polynomial::SparseCoefficientForm;
+using util::parallel::parallel_for;
+
+/// the minimum number of points decompressed by a single thread.
+const size_t DECOMPRESSION_CHUNK_SIZE = 64;
+
+CommitKey::CommitKey(const std::vector<G1Affine> &vec)
+        : powers_of_g{std::make_shared<const std::vector<G1Affine>>(vec)}, length{vec.size()} {}
 
-CommitKey::CommitKey(const std::vector<G1Affine> &vec) : powers_of_g{vec} {}
+CommitKey::CommitKey(std::vector<G1Affine> &&vec)
+        : powers_of_g{std::make_shared<const std::vector<G1Affine>>(std::move(vec))},
+          length{this->powers_of_g->size()} {}
+
+CommitKey::CommitKey(std::shared_ptr<const std::vector<G1Affine>> storage, size_t length)
+        : powers_of_g{std::move(storage)}, length{length} {
+    assert(this->powers_of_g != nullptr && this->length <= this->powers_of_g->size());
+    if (this->length < this->powers_of_g->size())
+        this->truncated_powers = std::make_shared<TruncatedPowers>();
+}
 
 size_t CommitKey::max_degree() const {
-    return this->powers_of_g.size() - 1;
+    return this->length - 1;
 }
 
 CommitKey CommitKey::truncate(size_t new_degree) const {
@@ -27,12 +49,20 @@ CommitKey CommitKey::truncate(size_t new_degree) const {
         throw Exception(Type::TRUNCATED_DEGREE_TOO_LARGE, "the input degree is too large.");
 
     if (new_degree == 1) new_degree += 1;
-    std::vector<G1Affine> new_vec{this->powers_of_g.begin(), this->powers_of_g.begin() + static_cast<long>(new_degree) + 1};
-    return CommitKey{new_vec};
+    return CommitKey{this->powers_of_g, new_degree + 1};
 }
 
-const std::vector<bls12_381::group::G1Affine> &CommitKey::get_powers_of_g() const {
-    return this->powers_of_g;
+std::span<const G1Affine> CommitKey::get_powers_of_g_view() const {
+    return {this->powers_of_g->data(), this->length};
+}
+
+const std::vector<G1Affine> &CommitKey::get_powers_of_g() const {
+    if (this->truncated_powers == nullptr) return *this->powers_of_g;
+    std::call_once(this->truncated_powers->flag, [this] {
+        this->truncated_powers->powers.assign(this->powers_of_g->begin(),
+                                              this->powers_of_g->begin() + static_cast<long>(this->length));
+    });
+    return this->truncated_powers->powers;
 }
 
 void CommitKey::check_polynomial_degree(const CoefficientForm &polynomial) const {
@@ -43,68 +73,102 @@ void CommitKey::check_polynomial_degree(const CoefficientForm &polynomial) const
         throw Exception(Type::POLY_DEGREE_TOO_LARGE, "degree of the committed polynomial is too large.");
 }
 
+void CommitKey::check_polynomial_degree(const SparseCoefficientForm &polynomial) const {
+    size_t poly_degree = polynomial.degree();
+    if (poly_degree == 0)
+        throw Exception(Type::POLY_DEGREE_IS_ZERO, "the committed polynomial has zero degree.");
+    if (poly_degree > this->max_degree())
+        throw Exception(Type::POLY_DEGREE_TOO_LARGE, "degree of the committed polynomial is too large.");
+}
+
 std::vector<uint8_t> CommitKey::to_raw_var_bytes() const {
-    std::vector<uint8_t> bytes{};
-    bytes.reserve(sizeof(uint64_t) + this->powers_of_g.size() * G1Affine::RAW_SIZE);
+    std::vector<uint8_t> bytes(this->raw_var_bytes_size());
+    this->write_raw_var_bytes(bytes);
+    return bytes;
+}
+
+std::vector<uint8_t> CommitKey::to_var_bytes() const {
+    std::vector<uint8_t> bytes(this->var_bytes_size());
+    this->write_var_bytes(bytes);
+    return bytes;
+}
 
-    const auto size = static_cast<uint64_t>(this->powers_of_g.size());
+size_t CommitKey::raw_var_bytes_size() const {
+    return sizeof(uint64_t) + this->length * G1Affine::RAW_SIZE;
+}
+
+size_t CommitKey::var_bytes_size() const {
+    return this->length * G1Affine::BYTE_SIZE;
+}
+
+void CommitKey::write_raw_var_bytes(std::span<uint8_t> buffer) const {
+    if (buffer.size() < this->raw_var_bytes_size())
+        throw Exception(Type::SERIALIZE_NO_ENOUGH_BYTES, "output buffer not long enough.");
+
+    const auto size = static_cast<uint64_t>(this->length);
     const auto size_bytes = to_le_bytes<uint64_t>(size);
-    bytes.insert(bytes.end(), size_bytes.begin(), size_bytes.end());
+    auto iter = std::copy(size_bytes.begin(), size_bytes.end(), buffer.begin());
 
-    for (const G1Affine &point: this->powers_of_g) {
+    for (const G1Affine &point: this->get_powers_of_g_view()) {
         const auto point_bytes = point.to_raw_bytes();
-        bytes.insert(bytes.end(), point_bytes.begin(), point_bytes.end());
+        iter = std::copy(point_bytes.begin(), point_bytes.end(), iter);
     }
-
-    return bytes;
 }
 
-std::vector<uint8_t> CommitKey::to_var_bytes() const {
-    std::vector<uint8_t> bytes{};
-    bytes.reserve(this->powers_of_g.size() * G1Affine::BYTE_SIZE);
+void CommitKey::write_var_bytes(std::span<uint8_t> buffer) const {
+    if (buffer.size() < this->var_bytes_size())
+        throw Exception(Type::SERIALIZE_NO_ENOUGH_BYTES, "output buffer not long enough.");
 
-    for (const G1Affine &point: this->powers_of_g) {
+    auto iter = buffer.begin();
+    for (const G1Affine &point: this->get_powers_of_g_view()) {
         const auto point_bytes = point.to_compressed();
-        bytes.insert(bytes.end(), point_bytes.begin(), point_bytes.end());
+        iter = std::copy(point_bytes.begin(), point_bytes.end(), iter);
     }
-
-    return bytes;
 }
 
-CommitKey CommitKey::from_slice_unchecked(const std::vector<uint8_t> &bytes) {
+CommitKey CommitKey::from_slice_unchecked(std::span<const uint8_t> bytes) {
+    if (bytes.size() < sizeof(uint64_t))
+        throw Exception(Type::SERIALIZE_NO_ENOUGH_BYTES, "input bytes not long enough.");
+
     std::array<uint8_t, sizeof(uint64_t)> size_bytes{};
-    std::copy(bytes.begin(), bytes.begin() + sizeof(uint64_t), size_bytes.begin());
+    std::copy_n(bytes.begin(), sizeof(uint64_t), size_bytes.begin());
     const auto size = from_le_bytes<uint64_t>(size_bytes);
 
     std::vector<G1Affine> powers_of_g;
     powers_of_g.reserve(size);
 
-    for (int i = sizeof(uint64_t); i < bytes.size(); i += G1Affine::RAW_SIZE) {
-        std::vector<uint8_t> point_bytes{};
-        point_bytes.reserve(G1Affine::RAW_SIZE);
-        std::copy(bytes.begin() + i, bytes.begin() + i + G1Affine::RAW_SIZE, point_bytes.begin());
-        const G1Affine point = G1Affine::from_slice_unchecked(point_bytes);
-        powers_of_g.push_back(point);
+    // a single buffer is refilled for every point, so decoding does not allocate per element.
+    std::vector<uint8_t> point_bytes(G1Affine::RAW_SIZE);
+    for (size_t i = sizeof(uint64_t); i + G1Affine::RAW_SIZE <= bytes.size(); i += G1Affine::RAW_SIZE) {
+        std::copy_n(bytes.begin() + static_cast<long>(i), G1Affine::RAW_SIZE, point_bytes.begin());
+        powers_of_g.push_back(G1Affine::from_slice_unchecked(point_bytes));
     }
 
-    return CommitKey{powers_of_g};
+    return CommitKey{std::move(powers_of_g)};
 }
 
-std::optional<CommitKey> CommitKey::from_slice(const std::vector<uint8_t> &bytes) {
+std::optional<CommitKey> CommitKey::from_slice(std::span<const uint8_t> bytes) {
     const uint64_t size = bytes.size() / G1Affine::BYTE_SIZE;
 
-    std::vector<G1Affine> powers_of_g;
-    powers_of_g.reserve(size);
-
-    for (int i = 0; i < bytes.size(); i += G1Affine::BYTE_SIZE) {
-        std::array<uint8_t, G1Affine::BYTE_SIZE> point_bytes{};
-        std::copy(bytes.begin() + i, bytes.begin() + i + G1Affine::BYTE_SIZE, point_bytes.begin());
-        const auto point_opt = G1Affine::from_compressed(point_bytes);
-        if (!point_opt.has_value()) return std::nullopt;
-        powers_of_g.push_back(point_opt.value());
-    }
-
-    return CommitKey{powers_of_g};
+    std::vector<G1Affine> powers_of_g(size);
+    std::atomic<bool> valid{true};
+
+    parallel_for(size, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end && valid.load(std::memory_order_relaxed); ++i) {
+            std::array<uint8_t, G1Affine::BYTE_SIZE> point_bytes{};
+            std::copy_n(bytes.begin() + static_cast<long>(i * G1Affine::BYTE_SIZE), G1Affine::BYTE_SIZE,
+                        point_bytes.begin());
+            const auto point_opt = G1Affine::from_compressed(point_bytes);
+            if (!point_opt.has_value()) {
+                valid.store(false, std::memory_order_relaxed);
+                return;
+            }
+            powers_of_g[i] = point_opt.value();
+        }
+    }, DECOMPRESSION_CHUNK_SIZE);
+
+    if (!valid.load()) return std::nullopt;
+    return CommitKey{std::move(powers_of_g)};
 }
 
 } // namespace kzg::structure
\ No newline at end of file
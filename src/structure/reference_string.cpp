@@ -5,6 +5,8 @@
 
 #include "group/g1_projective.h"
 #include "group/g2_affine.h"
+#include "group/gt.h"
+#include "pairing/pairing.h"
 
 #include "exception/exception.h"
 #include "utils/field.h"
@@ -15,6 +17,9 @@ namespace kzg::structure {
 using bls12_381::group::G1Affine;
 using bls12_381::group::G1Projective;
 using bls12_381::group::G2Affine;
+using bls12_381::group::Gt;
+using bls12_381::pairing::multi_miller_loop;
+using bls12_381::scalar::Scalar;
 
 using exception::Exception;
 using exception::Type;
@@ -23,6 +28,7 @@ using util::field::generate_vec_powers;
 using util::group::random_g1_point;
 using util::group::random_g2_point;
 using util::group::slow_multi_scalar_mul_single_base;
+using util::group::multi_scalar_mul;
 
 /**
  * the maximum degree is the degree of the constraint system + 6, because adding the blinding factors requires some
@@ -47,11 +53,11 @@ ReferenceString ReferenceString::setup(size_t max_degree, rng::core::RngCore &rn
 
     assert(powers_g.size() == max_degree + 1);
 
-    const auto normalized_g = G1Projective::batch_normalize(powers_g);
+    auto normalized_g = G1Projective::batch_normalize(powers_g);
     const auto h = G2Affine{random_g2_point(rng)};
     const auto x_2 = G2Affine{h * x};
 
-    return ReferenceString{CommitKey{normalized_g}, OpeningKey{G1Affine{g}, h, x_2}};
+    return ReferenceString{CommitKey{std::move(normalized_g)}, OpeningKey{G1Affine{g}, h, x_2}};
 }
 
 std::tuple<CommitKey, OpeningKey> ReferenceString::trim(size_t truncated_degree) {
@@ -59,63 +65,88 @@ std::tuple<CommitKey, OpeningKey> ReferenceString::trim(size_t truncated_degree)
     return {truncated_prover_key, this->opening_key};
 }
 
-auto ReferenceString::to_var_bytes() const -> std::vector<uint8_t> {
-    const auto bytes_opening = this->opening_key.to_bytes();
-    const auto bytes_commit = this->commit_key.to_var_bytes();
-
-    std::vector<uint8_t> res{};
-    res.reserve(240 + bytes_commit.size());
-
-    res.insert(res.end(), bytes_opening.begin(), bytes_opening.end());
-    res.insert(res.end(), bytes_commit.begin(), bytes_commit.end());
+auto ReferenceString::verify_structure(rng::core::RngCore &rng) const -> bool {
+    const auto powers_of_g = this->commit_key.get_powers_of_g_view();
+    if (powers_of_g.size() < 2) return false;
+    if (powers_of_g[0] != this->opening_key.g) return false;
+
+    std::vector<Scalar> randomness;
+    randomness.reserve(powers_of_g.size() - 1);
+    for (int i = 0; i < powers_of_g.size() - 1; ++i)
+        randomness.push_back(random_scalar(rng));
+
+    const auto lhs = G1Affine{multi_scalar_mul(powers_of_g.subspan(1), randomness)};
+    const auto rhs = G1Affine{multi_scalar_mul(powers_of_g.first(powers_of_g.size() - 1), randomness)};
+
+    const auto pairing = multi_miller_loop({
+                                                   {lhs,  this->opening_key.h_prepared},
+                                                   {-rhs, this->opening_key.h_beta_prepared}
+                                           })
+            .final_exponentiation();
+    return pairing == Gt::identity();
+}
 
+auto ReferenceString::to_var_bytes() const -> std::vector<uint8_t> {
+    std::vector<uint8_t> res(this->var_bytes_size());
+    this->write_var_bytes(res);
     return res;
 }
 
 auto ReferenceString::to_raw_var_bytes() const -> std::vector<uint8_t> {
-    const auto bytes_opening = this->opening_key.to_bytes();
-    const auto bytes_commit = this->commit_key.to_raw_var_bytes();
+    std::vector<uint8_t> res(this->raw_var_bytes_size());
+    this->write_raw_var_bytes(res);
+    return res;
+}
+
+auto ReferenceString::var_bytes_size() const -> size_t {
+    return OpeningKey::BYTE_SIZE + this->commit_key.var_bytes_size();
+}
 
-    std::vector<uint8_t> res{};
-    res.reserve(240 + bytes_commit.size());
+auto ReferenceString::raw_var_bytes_size() const -> size_t {
+    return OpeningKey::BYTE_SIZE + this->commit_key.raw_var_bytes_size();
+}
 
-    res.insert(res.end(), bytes_opening.begin(), bytes_opening.end());
-    res.insert(res.end(), bytes_commit.begin(), bytes_commit.end());
+void ReferenceString::write_var_bytes(std::span<uint8_t> buffer) const {
+    if (buffer.size() < this->var_bytes_size())
+        throw Exception(Type::SERIALIZE_NO_ENOUGH_BYTES, "output buffer not long enough.");
+    const auto bytes_opening = this->opening_key.to_bytes();
+    std::copy(bytes_opening.begin(), bytes_opening.end(), buffer.begin());
+    this->commit_key.write_var_bytes(buffer.subspan(OpeningKey::BYTE_SIZE));
+}
 
-    return res;
+void ReferenceString::write_raw_var_bytes(std::span<uint8_t> buffer) const {
+    if (buffer.size() < this->raw_var_bytes_size())
+        throw Exception(Type::SERIALIZE_NO_ENOUGH_BYTES, "output buffer not long enough.");
+    const auto bytes_opening = this->opening_key.to_bytes();
+    std::copy(bytes_opening.begin(), bytes_opening.end(), buffer.begin());
+    this->commit_key.write_raw_var_bytes(buffer.subspan(OpeningKey::BYTE_SIZE));
 }
 
-auto ReferenceString::from_slice(const std::vector<uint8_t> &bytes) -> std::optional<ReferenceString> {
+auto ReferenceString::from_slice(std::span<const uint8_t> bytes) -> std::optional<ReferenceString> {
     if (bytes.size() <= OpeningKey::BYTE_SIZE)
         throw Exception(Type::SERIALIZE_NO_ENOUGH_BYTES, "input bytes not long enough.");
 
     std::array<uint8_t, OpeningKey::BYTE_SIZE> bytes_opening{};
-    std::vector<uint8_t> bytes_commit{};
-    bytes_commit.reserve(bytes.size() - OpeningKey::BYTE_SIZE);
-
-    std::copy(bytes.begin(), bytes.begin() + OpeningKey::BYTE_SIZE, bytes_opening.begin());
-    bytes_commit.insert(bytes_commit.end(), bytes.begin() + OpeningKey::BYTE_SIZE, bytes.end());
+    std::copy_n(bytes.begin(), OpeningKey::BYTE_SIZE, bytes_opening.begin());
 
-
-    const auto opening_key_opt = OpeningKey::from_bytes(bytes_opening);
-    const auto commit_key_opt = CommitKey::from_slice(bytes_commit);
+    auto opening_key_opt = OpeningKey::from_bytes(bytes_opening);
+    auto commit_key_opt = CommitKey::from_slice(bytes.subspan(OpeningKey::BYTE_SIZE));
 
     if (!opening_key_opt.has_value() || !commit_key_opt.has_value()) return std::nullopt;
-    return ReferenceString{commit_key_opt.value(), opening_key_opt.value()};
+    return ReferenceString{std::move(commit_key_opt.value()), std::move(opening_key_opt.value())};
 }
 
-auto ReferenceString::from_slice_unchecked(const std::vector<uint8_t> &bytes) -> ReferenceString {
-    std::array<uint8_t, OpeningKey::BYTE_SIZE> bytes_opening{};
-    std::vector<uint8_t> bytes_commit{};
-    bytes_commit.reserve(bytes.size() - OpeningKey::BYTE_SIZE);
+auto ReferenceString::from_slice_unchecked(std::span<const uint8_t> bytes) -> ReferenceString {
+    if (bytes.size() <= OpeningKey::BYTE_SIZE)
+        throw Exception(Type::SERIALIZE_NO_ENOUGH_BYTES, "input bytes not long enough.");
 
-    std::copy(bytes.begin(), bytes.begin() + OpeningKey::BYTE_SIZE, bytes_opening.begin());
-    bytes_commit.insert(bytes_commit.end(), bytes.begin() + OpeningKey::BYTE_SIZE, bytes.end());
+    std::array<uint8_t, OpeningKey::BYTE_SIZE> bytes_opening{};
+    std::copy_n(bytes.begin(), OpeningKey::BYTE_SIZE, bytes_opening.begin());
 
-    const auto opening_key = OpeningKey::from_bytes(bytes_opening).value();
-    const auto commit_key = CommitKey::from_slice_unchecked(bytes_commit);
+    auto opening_key = OpeningKey::from_bytes(bytes_opening).value();
+    auto commit_key = CommitKey::from_slice_unchecked(bytes.subspan(OpeningKey::BYTE_SIZE));
 
-    return ReferenceString{commit_key, opening_key};
+    return ReferenceString{std::move(commit_key), std::move(opening_key)};
 }
 
 } // namespace kzg::structure
\ No newline at end of file
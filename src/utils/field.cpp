@@ -1,10 +1,14 @@
 #include "utils/field.h"
 
-#include <array>
+#include <algorithm>
+
+#include "utils/parallel.h"
+#include "utils/workspace.h"
 
 namespace kzg::util::field {
 
 using bls12_381::scalar::Scalar;
+using parallel::parallel_for;
 
 auto random_scalar(rng::core::RngCore &rng) -> Scalar {
     return Scalar::random(rng);
@@ -21,30 +25,52 @@ std::vector<Scalar> generate_vec_powers(const Scalar &value, size_t max_degree)
     return monomials;
 }
 
-void batch_inversion(std::vector<Scalar> &scalars) {
-    std::vector<Scalar> prod;
-    prod.reserve(scalars.size());
-    Scalar temp = Scalar::one();
+void batch_inversion(std::span<Scalar> scalars) {
+    const size_t size = scalars.size();
+    if (size == 0) return;
+    const size_t chunks = std::clamp<size_t>(size / BATCH_INVERSION_CHUNK_SIZE, 1, parallel::num_threads());
+    const size_t chunk_size = (size + chunks - 1) / chunks;
 
-    for (const auto &scalar: scalars) {
-        if (scalar != Scalar::zero()) {
-            temp *= scalar;
-            prod.push_back(temp);
+    // prefix[i] is the product of the non-zero scalars of the chunk of i before index i.
+    workspace::ScratchBuffer prefix_buffer{workspace::acquire_uninitialized(size)};
+    auto &prefix = *prefix_buffer;
+    std::vector<Scalar> products(chunks, Scalar::one());
+    parallel_for(chunks, [&](size_t first, size_t last) {
+        for (size_t chunk = first; chunk < last; ++chunk) {
+            Scalar product = Scalar::one();
+            for (size_t i = chunk * chunk_size; i < std::min(size, (chunk + 1) * chunk_size); ++i) {
+                prefix[i] = product;
+                if (!scalars[i].is_zero()) product *= scalars[i];
+            }
+            products[chunk] = product;
         }
-    }
-
-    temp = temp.invert().value();
-
-    int32_t sentinel = static_cast<int32_t>(prod.size()) - 2;
-    for (auto iter = scalars.rbegin(); iter != scalars.rend(); iter++) { // NOLINT(modernize-loop-convert)
-        if (*iter == Scalar::zero()) continue;
-        if (sentinel < -1) break;
+    });
 
-        Scalar new_temp = temp * *iter;
-        *iter = temp * ((sentinel != -1) ? prod[sentinel] : Scalar::one());
-        temp = new_temp;
-        sentinel--;
+    // the products of the chunks are not zero, and are inverted together.
+    std::vector<Scalar> chunk_prefix(chunks, Scalar::one());
+    Scalar total = Scalar::one();
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+        chunk_prefix[chunk] = total;
+        total *= products[chunk];
     }
+    Scalar inverse = total.invert().value();
+    for (size_t chunk = chunks; chunk > 0; --chunk) {
+        const Scalar chunk_inverse = inverse * chunk_prefix[chunk - 1];
+        inverse *= products[chunk - 1];
+        products[chunk - 1] = chunk_inverse;
+    }
+
+    parallel_for(chunks, [&](size_t first, size_t last) {
+        for (size_t chunk = first; chunk < last; ++chunk) {
+            Scalar remaining = products[chunk];
+            for (size_t i = std::min(size, (chunk + 1) * chunk_size); i > chunk * chunk_size; --i) {
+                if (scalars[i - 1].is_zero()) continue;
+                const Scalar scalar_inverse = remaining * prefix[i - 1];
+                remaining *= scalars[i - 1];
+                scalars[i - 1] = scalar_inverse;
+            }
+        }
+    });
 }
 
 } // namespace kzg::util::field
\ No newline at end of file
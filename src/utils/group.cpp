@@ -1,5 +1,8 @@
 #include "utils/group.h"
 
+#include <array>
+#include <cassert>
+
 #include "group/g1_affine.h"
 #include "group/g2_affine.h"
 
@@ -32,4 +35,56 @@ std::vector<G1Projective> slow_multi_scalar_mul_single_base(const std::vector<Sc
     return res;
 }
 
+namespace {
+
+/// Extracts the bits [offset, offset + width) of a little-endian scalar representation.
+uint64_t scalar_window(const std::array<uint8_t, Scalar::BYTE_SIZE> &bytes, size_t offset, size_t width) {
+    uint64_t res = 0;
+    for (size_t i = 0; i < width && offset + i < Scalar::BYTE_SIZE * 8; ++i) {
+        const size_t bit = offset + i;
+        res |= static_cast<uint64_t>((bytes[bit / 8] >> (bit % 8)) & 1) << i;
+    }
+    return res;
+}
+
+} // namespace
+
+G1Projective multi_scalar_mul(std::span<const G1Affine> bases, std::span<const Scalar> scalars) {
+    assert(bases.size() == scalars.size());
+    const size_t size = bases.size();
+    if (size == 0) return G1Projective{};
+
+    size_t width = 3;
+    while ((static_cast<size_t>(1) << (width + 2)) < size) width++;
+    if (width > 16) width = 16;
+
+    std::vector<std::array<uint8_t, Scalar::BYTE_SIZE>> digits;
+    digits.reserve(size);
+    for (const Scalar &scalar: scalars)
+        digits.push_back(scalar.to_bytes());
+
+    G1Projective res{};
+    std::vector<G1Projective> buckets((static_cast<size_t>(1) << width) - 1);
+    const size_t num_bits = Scalar::BYTE_SIZE * 8;
+    const size_t num_windows = (num_bits + width - 1) / width;
+
+    for (size_t w = num_windows; w-- > 0;) {
+        for (size_t i = 0; i < width; ++i)
+            res = res + res;
+
+        std::fill(buckets.begin(), buckets.end(), G1Projective{});
+        for (size_t i = 0; i < size; ++i) {
+            const uint64_t digit = scalar_window(digits[i], w * width, width);
+            if (digit != 0) buckets[digit - 1] += bases[i];
+        }
+
+        G1Projective running_sum{};
+        for (auto iter = buckets.rbegin(); iter != buckets.rend(); iter++) { // NOLINT(modernize-loop-convert)
+            running_sum += *iter;
+            res += running_sum;
+        }
+    }
+    return res;
+}
+
 } // namespace kzg::util::group
\ No newline at end of file
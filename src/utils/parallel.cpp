@@ -0,0 +1,168 @@
+#include "utils/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace kzg::util::parallel {
+
+std::atomic<size_t> configured_threads{0};
+
+/// Set while the thread runs a chunk of a loop.
+thread_local bool in_region = false;
+
+size_t num_threads() {
+    const size_t threads = configured_threads.load();
+    if (threads != 0) return threads;
+    return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+void set_num_threads(size_t threads) {
+    configured_threads.store(threads);
+}
+
+bool in_parallel_region() {
+    return in_region;
+}
+
+ScopedNumThreads::ScopedNumThreads(size_t threads) : previous{configured_threads.load()} {
+    set_num_threads(threads);
+}
+
+ScopedNumThreads::~ScopedNumThreads() {
+    set_num_threads(this->previous);
+}
+
+namespace detail {
+
+/// A loop shared by the caller and the workers, living on the stack of the caller.
+struct Job {
+    TaskRef task{};
+    size_t size = 0;
+    size_t chunk_size = 0;
+    size_t chunks = 0;
+    /// the number of workers allowed to join the caller.
+    size_t max_workers = 0;
+    std::atomic<size_t> next_chunk{0};
+    std::exception_ptr error{};
+    std::mutex error_mutex{};
+
+    /// Runs the chunks not yet taken, and records the first exception.
+    void run() {
+        const bool was_in_region = in_region;
+        in_region = true;
+        for (size_t chunk = this->next_chunk++; chunk < this->chunks; chunk = this->next_chunk++) {
+            try {
+                const size_t begin = chunk * this->chunk_size;
+                this->task.call(this->task.object, begin, std::min(begin + this->chunk_size, this->size));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock{this->error_mutex};
+                if (!this->error) this->error = std::current_exception();
+                this->next_chunk = this->chunks;
+            }
+        }
+        in_region = was_in_region;
+    }
+};
+
+/// Worker threads created on first use and kept until exit, which pick up one job at a time.
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    Job *job = nullptr;
+    uint64_t generation = 0;
+    /// the number of workers which joined the current job.
+    size_t joined = 0;
+    /// the number of workers still running chunks of the current job.
+    size_t active = 0;
+    bool stopping = false;
+    /// Held by the caller of the running job, so that concurrent loops run inline instead of queueing.
+    std::mutex submit_mutex;
+
+    void work() {
+        uint64_t seen = 0;
+        std::unique_lock<std::mutex> lock{this->mutex};
+        while (true) {
+            this->wake.wait(lock, [&] {
+                return this->stopping || (this->job != nullptr && this->generation != seen
+                                          && this->joined < this->job->max_workers);
+            });
+            if (this->stopping) return;
+            seen = this->generation;
+            Job *current = this->job;
+            ++this->joined;
+            ++this->active;
+            lock.unlock();
+            current->run();
+            lock.lock();
+            if (--this->active == 0) this->done.notify_all();
+        }
+    }
+
+public:
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock{this->mutex};
+            this->stopping = true;
+        }
+        this->wake.notify_all();
+        for (auto &worker: this->workers) worker.join();
+    }
+
+    /// Runs the job with the help of the workers, or returns false if another job is running.
+    bool try_run(Job &current) {
+        std::unique_lock<std::mutex> submit_lock{this->submit_mutex, std::try_to_lock};
+        if (!submit_lock.owns_lock()) return false;
+        {
+            std::lock_guard<std::mutex> lock{this->mutex};
+            while (this->workers.size() < current.max_workers)
+                this->workers.emplace_back([this] { this->work(); });
+            this->job = &current;
+            ++this->generation;
+            this->joined = 0;
+        }
+        this->wake.notify_all();
+        current.run();
+
+        // every chunk is taken, the job is retired once the workers which joined it are done.
+        std::unique_lock<std::mutex> lock{this->mutex};
+        this->done.wait(lock, [&] { return this->active == 0; });
+        this->job = nullptr;
+        return true;
+    }
+};
+
+ThreadPool &pool() {
+    static ThreadPool instance;
+    return instance;
+}
+
+void parallel_for(size_t size, TaskRef task, size_t min_chunk_size) {
+    if (size == 0) return;
+    min_chunk_size = std::max<size_t>(min_chunk_size, 1);
+    const size_t threads = std::min(num_threads(), (size + min_chunk_size - 1) / min_chunk_size);
+    if (threads <= 1 || in_region) {
+        task.call(task.object, 0, size);
+        return;
+    }
+
+    const size_t chunk_size = (size + threads - 1) / threads;
+    const size_t chunks = (size + chunk_size - 1) / chunk_size;
+    Job current{.task = task, .size = size, .chunk_size = chunk_size, .chunks = chunks, .max_workers = chunks - 1};
+    if (!pool().try_run(current)) {
+        task.call(task.object, 0, size);
+        return;
+    }
+    if (current.error) std::rethrow_exception(current.error);
+}
+
+} // namespace detail
+
+} // namespace kzg::util::parallel
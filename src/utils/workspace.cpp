@@ -0,0 +1,104 @@
+#include "utils/workspace.h"
+
+#include <algorithm>
+
+namespace kzg::util::workspace {
+
+using bls12_381::scalar::Scalar;
+
+/// The buffers pooled by a thread, in no particular order, and the total size of their storage in bytes.
+struct Pool {
+    std::vector<std::vector<Scalar>> buffers;
+    size_t bytes = 0;
+};
+
+/**
+ * The pool of the calling thread. The worker threads of <tt>util::parallel</tt> live as long as the process, so the
+ * pools of the workers persist across parallel loops like the pool of the main thread.
+ */
+Pool &local_pool() {
+    thread_local Pool pool;
+    return pool;
+}
+
+/// Size of the storage of a buffer in bytes.
+size_t storage_bytes(const std::vector<Scalar> &buffer) {
+    return buffer.capacity() * sizeof(Scalar);
+}
+
+/// Removes the smallest pooled buffer which holds at least <tt>size</tt> elements, or returns an empty one if none do.
+std::vector<Scalar> take_best_fit(size_t size) {
+    auto &pool = local_pool();
+    auto best = pool.buffers.end();
+    for (auto iter = pool.buffers.begin(); iter != pool.buffers.end(); ++iter)
+        if (iter->capacity() >= size && (best == pool.buffers.end() || iter->capacity() < best->capacity()))
+            best = iter;
+    if (best == pool.buffers.end()) return {};
+
+    std::vector<Scalar> res = std::move(*best);
+    *best = std::move(pool.buffers.back());
+    pool.buffers.pop_back();
+    pool.bytes -= storage_bytes(res);
+    return res;
+}
+
+std::vector<Scalar> acquire(size_t size) {
+    std::vector<Scalar> res = take_best_fit(size);
+    res.assign(size, Scalar::zero());
+    return res;
+}
+
+std::vector<Scalar> acquire_uninitialized(size_t size) {
+    std::vector<Scalar> res = take_best_fit(size);
+    res.resize(size);
+    return res;
+}
+
+void recycle(std::vector<Scalar> &&buffer) {
+    std::vector<Scalar> storage = std::move(buffer);
+    buffer = std::vector<Scalar>{};
+    const size_t bytes = storage_bytes(storage);
+    if (bytes == 0 || bytes > MAX_POOLED_BYTES) return;
+
+    // the smallest buffers are evicted first, and the recycled one is dropped if it is the smallest.
+    auto &pool = local_pool();
+    while (pool.buffers.size() >= MAX_POOLED_BUFFERS || pool.bytes + bytes > MAX_POOLED_BYTES) {
+        const auto smallest = std::min_element(pool.buffers.begin(), pool.buffers.end(), [](const auto &a, const auto &b) {
+            return a.capacity() < b.capacity();
+        });
+        if (smallest->capacity() >= storage.capacity()) return;
+        pool.bytes -= storage_bytes(*smallest);
+        *smallest = std::move(pool.buffers.back());
+        pool.buffers.pop_back();
+    }
+    pool.bytes += bytes;
+    pool.buffers.push_back(std::move(storage));
+}
+
+size_t pooled_buffers() {
+    return local_pool().buffers.size();
+}
+
+size_t pooled_bytes() {
+    return local_pool().bytes;
+}
+
+void clear() {
+    local_pool() = Pool{};
+}
+
+ScratchBuffer::ScratchBuffer(size_t size) : buffer{acquire(size)} {}
+
+ScratchBuffer::ScratchBuffer(std::vector<Scalar> &&buffer) : buffer{std::move(buffer)} {}
+
+ScratchBuffer::~ScratchBuffer() {
+    recycle(std::move(this->buffer));
+}
+
+std::vector<Scalar> ScratchBuffer::take() {
+    std::vector<Scalar> res = std::move(this->buffer);
+    this->buffer = std::vector<Scalar>{};
+    return res;
+}
+
+} // namespace kzg::util::workspace
@@ -1,17 +1,24 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
 #include <tuple>
 #include <vector>
 
 #include "impl/os_rng.h"
 
 #include "polynomial/coefficient.h"
+#include "polynomial/sparse.h"
 #include "process/commit.h"
 #include "process/evaluate.h"
 #include "process/verify.h"
 #include "structure/commit_key.h"
 #include "structure/opening_key.h"
 #include "structure/reference_string.h"
+#include "utils/parallel.h"
+#include "utils/workspace.h"
 
 using bls12_381::scalar::Scalar;
 using rng::impl::OsRng;
@@ -30,6 +37,26 @@ using kzg::process::verify::verify_multiple_polynomials;
 using kzg::structure::BatchProof;
 using kzg::polynomial::CoefficientForm;
 
+/// whether the replaced global allocation functions below count the allocations.
+std::atomic<bool> counting_allocations{false};
+/// number of allocations made while <tt>counting_allocations</tt> is set.
+std::atomic<size_t> allocation_count{0};
+
+void *operator new(size_t size) {
+    if (counting_allocations.load(std::memory_order_relaxed)) allocation_count++;
+    if (void *ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+    throw std::bad_alloc{};
+}
+
+// kept out of line, so that the compiler does not pair the inlined free with the new expressions of this file.
+[[gnu::noinline]] void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+[[gnu::noinline]] void operator delete(void *ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
 std::tuple<CommitKey, OpeningKey> setup_test(size_t degree) {
     OsRng rng{};
     auto srs = ReferenceString::setup(degree, rng);
@@ -55,6 +82,21 @@ TEST(Commitment, CommitSingle) {
     EXPECT_TRUE(verify);
 }
 
+TEST(Commitment, CommitSparse) {
+    const size_t degree = 25;
+    const auto [commit_key, opening_key] = setup_test(degree);
+
+    OsRng rng;
+    const kzg::polynomial::SparseCoefficientForm polynomial{{{0, Scalar::random(rng)}, {degree, Scalar::one()}}};
+    const auto commitment = commit(commit_key, polynomial);
+    EXPECT_EQ(commitment.to_bytes(), commit(commit_key, polynomial.to_dense()).to_bytes());
+
+    const auto proof = create_witness_single(commit_key, polynomial, Scalar{10});
+    const auto dense_proof = create_witness_single(commit_key, polynomial.to_dense(), Scalar{10});
+    EXPECT_EQ(proof.witness.to_bytes(), dense_proof.witness.to_bytes());
+    EXPECT_TRUE(verify_single_polynomial(opening_key, commitment, proof));
+}
+
 TEST(Commitment, CommitMultiple) {
     // 1. setup
     const size_t degree = 27;
@@ -184,4 +226,56 @@ TEST(Commitment, OpeningKeySerialization) {
     const auto ok_opt = OpeningKey::from_bytes(bytes);
     const auto recovered_bytes = ok_opt->to_bytes();
     EXPECT_EQ(bytes, recovered_bytes);
-}
\ No newline at end of file
+}
+
+TEST(Commitment, CommitKeyTruncateSharesStorage) {
+    const auto [commit_key, _] = setup_test(31);
+    const auto truncated = commit_key.truncate(15);
+    EXPECT_EQ(truncated.max_degree(), 15);
+    EXPECT_EQ(truncated.get_powers_of_g_view().data(), commit_key.get_powers_of_g_view().data());
+
+    // the vector accessor of a truncated key holds exactly its visible elements.
+    const std::vector<bls12_381::group::G1Affine> &powers = truncated.get_powers_of_g();
+    EXPECT_EQ(powers.size(), 16);
+    EXPECT_TRUE(std::equal(powers.begin(), powers.end(), commit_key.get_powers_of_g_view().begin()));
+    EXPECT_EQ(&commit_key.get_powers_of_g(), &commit_key.get_powers_of_g());
+
+    OsRng osRng;
+    const auto polynomial = CoefficientForm::random(15, osRng);
+    EXPECT_EQ(commit(truncated, polynomial).get_content(), commit(commit_key, polynomial).get_content());
+}
+
+TEST(Commitment, CommitKeyByteParallel) {
+    const kzg::util::parallel::ScopedNumThreads threads{4};
+    const auto [commit_key, _] = setup_test(1 << 9);
+    auto bytes = commit_key.to_var_bytes();
+    const auto ck_p = CommitKey::from_slice(bytes);
+    ASSERT_TRUE(ck_p.has_value());
+    EXPECT_EQ(bytes, ck_p->to_var_bytes());
+
+    std::fill(bytes.end() - 3 * bls12_381::group::G1Affine::BYTE_SIZE,
+              bytes.end() - 2 * bls12_381::group::G1Affine::BYTE_SIZE, 0xff);
+    EXPECT_FALSE(CommitKey::from_slice(bytes).has_value());
+}
+
+TEST(Commitment, WitnessWithoutAllocation) {
+    const size_t degree = 25;
+    const auto [commit_key, opening_key] = setup_test(degree);
+    OsRng osRng;
+    const auto polynomial = CoefficientForm::random(degree, osRng);
+    const auto commitment = commit(commit_key, polynomial);
+
+    // the first witness fills the workspace, the next ones take their quotient from it.
+    kzg::util::workspace::clear();
+    static_cast<void>(create_witness_single(commit_key, polynomial, Scalar{10}));
+    allocation_count = 0;
+    counting_allocations = true;
+    const auto proof_1 = create_witness_single(commit_key, polynomial, Scalar{10});
+    const auto proof_2 = create_witness_single(commit_key, polynomial, Scalar{11});
+    counting_allocations = false;
+
+    EXPECT_EQ(allocation_count.load(), 0);
+    EXPECT_TRUE(verify_single_polynomial(opening_key, commitment, proof_1));
+    EXPECT_TRUE(verify_single_polynomial(opening_key, commitment, proof_2));
+    kzg::util::workspace::clear();
+}
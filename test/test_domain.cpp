@@ -2,8 +2,15 @@
 
 #include <vector>
 
+#include "scalar/constant.h"
+
+#include "exception/exception.h"
 #include "domain/domain.h"
+#include "domain/extension.h"
 #include "domain/iterator.h"
+#include "polynomial/evaluation.h"
+#include "domain/quotient.h"
+#include "utils/parallel.h"
 
 using bls12_381::scalar::Scalar;
 using kzg::domain::EvaluationDomain;
@@ -49,4 +56,281 @@ TEST(Domain, Serialization) {
         const EvaluationDomain domain_recovered = EvaluationDomain::from_bytes(domain_bytes).value();
         EXPECT_EQ(domain, domain_recovered);
     }
-}
\ No newline at end of file
+}
+
+TEST(Domain, FourierMatchesNaiveEvaluation) {
+    const EvaluationDomain domain{16};
+    std::vector<Scalar> coefficients;
+    for (uint64_t i = 0; i < 16; ++i) coefficients.emplace_back(i * i + 3);
+    const auto original = coefficients;
+    const auto evaluations = domain.fast_fourier(coefficients);
+
+    size_t index = 0;
+    for (const auto &element: domain.iter()) {
+        Scalar expected = Scalar::zero();
+        for (auto iter = original.rbegin(); iter != original.rend(); iter++) // NOLINT(modernize-loop-convert)
+            expected = expected * element + *iter;
+        EXPECT_EQ(evaluations[index++], expected);
+    }
+}
+
+TEST(Domain, MovedFromDomainKeepsTwiddles) {
+    EvaluationDomain domain{16};
+    const EvaluationDomain moved{std::move(domain)};
+    EvaluationDomain assigned{};
+    assigned = std::move(domain); // NOLINT(bugprone-use-after-move)
+
+    std::vector<Scalar> coefficients;
+    for (uint64_t i = 0; i < 16; ++i) coefficients.emplace_back(i + 1);
+    auto input = coefficients;
+    auto expected = moved.fast_fourier(input);
+    input = coefficients;
+    EXPECT_EQ(domain.fast_fourier(input), expected); // NOLINT(bugprone-use-after-move)
+    input = coefficients;
+    EXPECT_EQ(assigned.fast_fourier(input), expected);
+    EXPECT_EQ(domain.inverse_fast_fourier(expected), coefficients); // NOLINT(bugprone-use-after-move)
+}
+
+TEST(Domain, TwiddlesShared) {
+    const EvaluationDomain domain_1{1 << 6};
+    const EvaluationDomain domain_2{1 << 6};
+    EXPECT_EQ(domain_1.twiddles().size(), (1 << 6) - 1);
+    EXPECT_EQ(domain_1.twiddles().data(), domain_2.twiddles().data());
+    EXPECT_EQ(domain_1.group_generator() * domain_1.group_generator_inverse(), Scalar::one());
+    EXPECT_EQ(domain_1.size_as_field_element() * domain_1.size_inverse(), Scalar::one());
+}
+
+TEST(Domain, ParallelFourier) {
+    const uint32_t log_size = 10;
+    const EvaluationDomain domain{1 << log_size};
+    std::vector<Scalar> serial;
+    for (uint64_t i = 0; i < domain.size(); ++i) serial.emplace_back(i * 7 + 1);
+    auto parallel = serial;
+
+    kzg::domain::serial_fast_fourier(serial, domain.twiddles(), log_size);
+    for (const size_t threads: {2, 3, 4, 16}) {
+        const kzg::util::parallel::ScopedNumThreads scoped{threads};
+        auto values = parallel;
+        kzg::domain::parallel_fast_fourier(values, domain.twiddles(), log_size);
+        EXPECT_EQ(values, serial);
+    }
+}
+
+TEST(Domain, SixStepFourier) {
+    for (uint32_t log_size = 1; log_size < 12; ++log_size) {
+        const EvaluationDomain domain{static_cast<uint64_t>(1) << log_size};
+        std::vector<Scalar> serial;
+        for (uint64_t i = 0; i < domain.size(); ++i) serial.emplace_back(i * i + 5);
+        auto six_step = serial;
+        auto reference = serial;
+
+        kzg::domain::serial_fast_fourier(reference, domain.group_generator(), log_size);
+        kzg::domain::serial_fast_fourier(serial, domain.twiddles(), log_size);
+        kzg::domain::six_step_fast_fourier(six_step, domain.twiddles(), log_size);
+        EXPECT_EQ(serial, reference);
+        EXPECT_EQ(six_step, reference);
+    }
+}
+
+TEST(Domain, BitReversedFourier) {
+    const uint32_t log_size = 5;
+    const EvaluationDomain domain{1 << log_size};
+    std::vector<Scalar> coefficients;
+    for (uint64_t i = 0; i < domain.size(); ++i) coefficients.emplace_back(3 * i + 2);
+    auto natural = coefficients;
+    domain.fast_fourier_in_place(natural);
+
+    auto bit_reversed = coefficients;
+    domain.fast_fourier_bit_reversed_in_place(bit_reversed);
+    for (uint32_t k = 0; k < domain.size(); ++k) {
+        uint32_t rk = 0;
+        for (uint32_t i = 0; i < log_size; ++i) rk |= ((k >> i) & 1) << (log_size - 1 - i);
+        EXPECT_EQ(bit_reversed[rk], natural[k]);
+    }
+
+    domain.inverse_fast_fourier_bit_reversed_in_place(bit_reversed);
+    EXPECT_EQ(bit_reversed, coefficients);
+}
+
+TEST(Domain, BatchFourier) {
+    const EvaluationDomain domain{1 << 6};
+    std::vector<std::vector<Scalar>> columns;
+    for (uint64_t c = 0; c < 11; ++c) {
+        std::vector<Scalar> column;
+        for (uint64_t i = 0; i < 50; ++i) column.emplace_back(c * 100 + i * i);
+        columns.push_back(column);
+    }
+    const auto original = columns;
+
+    const kzg::util::parallel::ScopedNumThreads threads{2};
+    domain.fast_fourier_batch_in_place(columns);
+    for (size_t c = 0; c < columns.size(); ++c) {
+        auto expected = original[c];
+        domain.fast_fourier_in_place(expected);
+        EXPECT_EQ(columns[c], expected);
+    }
+
+    domain.inverse_fast_fourier_batch_in_place(columns);
+    for (size_t c = 0; c < columns.size(); ++c) {
+        auto expected = original[c];
+        expected.resize(domain.size(), Scalar::zero());
+        EXPECT_EQ(columns[c], expected);
+    }
+}
+
+TEST(Domain, CosetFourier) {
+    const EvaluationDomain domain{8};
+    const Scalar shift{5};
+    std::vector<Scalar> coefficients = {Scalar{1}, Scalar{2}, Scalar{3}, Scalar{4}, Scalar{5}};
+    auto evaluations = coefficients;
+    domain.coset_fast_fourier_in_place(evaluations, shift);
+
+    size_t index = 0;
+    for (const auto &element: domain.iter()) {
+        Scalar expected = Scalar::zero();
+        for (auto iter = coefficients.rbegin(); iter != coefficients.rend(); iter++) // NOLINT(modernize-loop-convert)
+            expected = expected * (shift * element) + *iter;
+        EXPECT_EQ(evaluations[index++], expected);
+    }
+
+    domain.coset_inverse_fast_fourier_in_place(evaluations, shift);
+    coefficients.resize(domain.size(), Scalar::zero());
+    EXPECT_EQ(evaluations, coefficients);
+}
+
+TEST(Domain, LowDegreeExtension) {
+    const EvaluationDomain domain{16};
+    const Scalar offset = bls12_381::scalar::constant::GENERATOR;
+    std::vector<Scalar> coefficients;
+    for (uint64_t i = 0; i < 60; ++i) coefficients.emplace_back(i * 3 + 1);
+
+    const auto shifts = kzg::domain::extension_shifts(domain, 4, offset);
+    const auto cosets = kzg::domain::low_degree_extension(domain, coefficients, 4, offset);
+    ASSERT_EQ(cosets.size(), 4);
+    for (size_t i = 0; i < cosets.size(); ++i) {
+        size_t index = 0;
+        for (const auto &element: domain.iter()) {
+            Scalar expected = Scalar::zero();
+            for (auto iter = coefficients.rbegin(); iter != coefficients.rend(); iter++) // NOLINT(modernize-loop-convert)
+                expected = expected * (shifts[i] * element) + *iter;
+            EXPECT_EQ(cosets[i][index++], expected);
+        }
+    }
+
+    auto recovered = kzg::domain::inverse_low_degree_extension(domain, cosets, offset);
+    coefficients.resize(recovered.size(), Scalar::zero());
+    EXPECT_EQ(recovered, coefficients);
+}
+
+TEST(Domain, MixedRadixFourier) {
+    for (const uint64_t size: {3, 6, 12, 24, 48}) {
+        const auto domain = EvaluationDomain::mixed_radix(size);
+        ASSERT_EQ(domain.size(), size);
+        EXPECT_FALSE(domain.is_radix_2());
+        EXPECT_EQ(domain.group_generator().pow({size, 0, 0, 0}), Scalar::one());
+        EXPECT_NE(domain.group_generator().pow({size / 3, 0, 0, 0}), Scalar::one());
+
+        std::vector<Scalar> coefficients;
+        for (uint64_t i = 0; i < size; ++i) coefficients.emplace_back(i * 7 + 2);
+        auto evaluations = coefficients;
+        domain.fast_fourier_in_place(evaluations);
+
+        size_t index = 0;
+        for (const auto &element: domain.iter()) {
+            Scalar expected = Scalar::zero();
+            for (auto iter = coefficients.rbegin(); iter != coefficients.rend(); iter++) // NOLINT(modernize-loop-convert)
+                expected = expected * element + *iter;
+            EXPECT_EQ(evaluations[index++], expected);
+        }
+
+        domain.inverse_fast_fourier_in_place(evaluations);
+        EXPECT_EQ(evaluations, coefficients);
+    }
+    EXPECT_TRUE(EvaluationDomain::mixed_radix(16).is_radix_2());
+}
+
+TEST(Domain, PrunedFourier) {
+    const EvaluationDomain domain{64};
+    for (const size_t input_length: {1, 5, 16, 33, 64}) {
+        std::vector<Scalar> coefficients;
+        for (uint64_t i = 0; i < input_length; ++i) coefficients.emplace_back(i * 5 + 4);
+        auto expected = coefficients;
+        domain.fast_fourier_in_place(expected);
+
+        for (const size_t output_length: {1, 7, 16, 40, 64}) {
+            auto evaluations = coefficients;
+            domain.fast_fourier_pruned_in_place(evaluations, output_length);
+            EXPECT_EQ(evaluations, std::vector<Scalar>(expected.begin(), expected.begin() + output_length));
+
+            auto bit_reversed = coefficients;
+            domain.fast_fourier_bit_reversed_pruned_in_place(bit_reversed);
+            auto reference = coefficients;
+            domain.fast_fourier_bit_reversed_in_place(reference);
+            EXPECT_EQ(bit_reversed, reference);
+
+            domain.inverse_fast_fourier_bit_reversed_pruned_in_place(bit_reversed, output_length);
+            auto recovered = coefficients;
+            recovered.resize(64, Scalar::zero());
+            recovered.resize(output_length);
+            EXPECT_EQ(bit_reversed, recovered);
+        }
+    }
+}
+
+TEST(Domain, VanishingQuotient) {
+    const EvaluationDomain domain{16};
+    std::vector<Scalar> quotient;
+    for (uint64_t i = 0; i < 45; ++i) quotient.emplace_back(i * 11 + 6);
+    std::vector<Scalar> remainder;
+    for (uint64_t i = 0; i < 16; ++i) remainder.emplace_back(i + 1);
+
+    // p = t * (X ^ 16 - 1) + r
+    std::vector<Scalar> dividend(quotient.size() + 16, Scalar::zero());
+    for (size_t i = 0; i < quotient.size(); ++i) {
+        dividend[i + 16] += quotient[i];
+        dividend[i] -= quotient[i];
+    }
+    auto exact = dividend;
+    for (size_t i = 0; i < remainder.size(); ++i) dividend[i] += remainder[i];
+
+    const auto [q, r] = kzg::domain::divide_by_vanishing_polynomial(domain, dividend);
+    EXPECT_EQ(q, quotient);
+    EXPECT_EQ(r, remainder);
+    EXPECT_EQ(kzg::domain::quotient_over_coset(domain, exact, bls12_381::scalar::constant::GENERATOR), quotient);
+    EXPECT_THROW(kzg::domain::quotient_over_coset(domain, exact, domain.group_generator()), kzg::exception::Exception);
+}
+
+TEST(Domain, VanishingPolynomialOverCoset) {
+    const EvaluationDomain domain{32};
+    for (const uint64_t degree: {0, 4, 6, 31}) {
+        const auto evaluations = domain.evaluate_vanishing_polynomial_over_coset(degree);
+        size_t index = 0;
+        for (const auto &element: domain.iter()) {
+            const Scalar point = bls12_381::scalar::constant::GENERATOR * element;
+            EXPECT_EQ(evaluations[index++], point.pow({degree, 0, 0, 0}) - Scalar::one());
+        }
+    }
+}
+
+TEST(Domain, ElementRange) {
+    const EvaluationDomain domain{64};
+    const auto elements = domain.elements();
+    ASSERT_EQ(elements.size(), 64);
+    EXPECT_EQ(domain.iter().size(), 64);
+
+    size_t index = 0;
+    for (const auto &element: domain.iter()) EXPECT_EQ(elements[index++], element);
+    EXPECT_EQ(elements.begin() + 64, elements.end());
+    EXPECT_EQ(&EvaluationDomain{64}.elements()[0], &elements[0]);
+
+    const auto parts = elements.subrange(3, 50).split(4);
+    ASSERT_EQ(parts.size(), 4);
+    size_t covered = 3;
+    for (const auto &part: parts) {
+        EXPECT_EQ(part.offset(), covered);
+        for (size_t i = 0; i < part.size(); ++i)
+            EXPECT_EQ(part[i], domain.group_generator().pow({part.offset() + i, 0, 0, 0}));
+        covered += part.size();
+    }
+    EXPECT_EQ(covered, 50);
+}
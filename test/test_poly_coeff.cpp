@@ -2,7 +2,14 @@
 
 #include "impl/os_rng.h"
 #include "scalar/scalar.h"
+#include "exception/exception.h"
 #include "polynomial/coefficient.h"
+#include "polynomial/division.h"
+#include "polynomial/expression.h"
+#include "polynomial/multiplication.h"
+#include "polynomial/sparse.h"
+#include "polynomial/subproduct_tree.h"
+#include "utils/parallel.h"
 
 using bls12_381::scalar::Scalar;
 using kzg::polynomial::CoefficientForm;
@@ -14,6 +21,27 @@ TEST(Coefficient, Evaluation) {
     EXPECT_EQ(evaluation, -Scalar{7});
 }
 
+TEST(Coefficient, HornerEvaluation) {
+    rng::impl::OsRng rng;
+    const kzg::util::parallel::ScopedNumThreads threads{4};
+    for (const size_t degree: {0, 15, 20000}) {
+        const CoefficientForm poly = CoefficientForm::random(degree, rng);
+        const std::vector<Scalar> points = {Scalar::random(rng), Scalar::zero(), Scalar::one(), Scalar::random(rng)};
+
+        const auto evaluations = poly.evaluate(points);
+        for (size_t j = 0; j < points.size(); ++j) {
+            Scalar expected = Scalar::zero();
+            Scalar power = Scalar::one();
+            for (size_t i = 0; i <= degree; ++i) {
+                expected += poly[i] * power;
+                power *= points[j];
+            }
+            EXPECT_EQ(evaluations[j], expected);
+            EXPECT_EQ(poly.evaluate(points[j]), expected);
+        }
+    }
+}
+
 TEST(Coefficient, Ruffini) {
     const CoefficientForm quadratic{{Scalar{4}, -Scalar{4}, Scalar::one()}};
     const CoefficientForm quotient = quadratic.ruffini(Scalar{2});
@@ -46,4 +74,140 @@ TEST(Coefficient, Serialization) {
     const auto poly_bytes = poly.to_var_bytes();
     const CoefficientForm poly_decoded = CoefficientForm::from_slice(poly_bytes).value();
     EXPECT_EQ(poly, poly_decoded);
-}
\ No newline at end of file
+}
+
+TEST(Coefficient, Multiplication) {
+    rng::impl::OsRng rng;
+    for (const auto &[degree_a, degree_b]: std::vector<std::pair<size_t, size_t>>{{0, 0}, {1, 3}, {7, 8}, {10, 1}, {20, 3}, {40, 17}}) {
+        const CoefficientForm a = CoefficientForm::random(degree_a, rng);
+        const CoefficientForm b = CoefficientForm::random(degree_b, rng);
+
+        std::vector<Scalar> expected(degree_a + degree_b + 1, Scalar::zero());
+        for (size_t i = 0; i <= degree_a; ++i)
+            for (size_t j = 0; j <= degree_b; ++j)
+                expected[i + j] += a[i] * b[j];
+
+        EXPECT_EQ(a * b, CoefficientForm{expected});
+        CoefficientForm square{a};
+        square *= square;
+        EXPECT_EQ(square.evaluate(Scalar{3}), a.evaluate(Scalar{3}) * a.evaluate(Scalar{3}));
+    }
+}
+
+TEST(Coefficient, MultiplicationMethods) {
+    rng::impl::OsRng rng;
+    for (const auto &[size_a, size_b]: std::vector<std::pair<size_t, size_t>>{{30, 30}, {57, 200}, {300, 1500}, {7, 1000}}) {
+        const auto a = CoefficientForm::random(size_a - 1, rng).get_coefficients();
+        const auto b = CoefficientForm::random(size_b - 1, rng).get_coefficients();
+        const auto expected = kzg::polynomial::schoolbook_multiply(a, b);
+        EXPECT_EQ(kzg::polynomial::karatsuba_multiply(a, b), expected);
+        EXPECT_EQ(kzg::polynomial::fourier_multiply(a, b), expected);
+        EXPECT_EQ(kzg::polynomial::unbalanced_multiply(b, a), expected);
+        EXPECT_EQ(kzg::polynomial::multiply(a, b), expected);
+    }
+}
+
+TEST(Coefficient, DivideWithRemainder) {
+    rng::impl::OsRng rng;
+    for (const auto &[degree_q, degree_b]: std::vector<std::pair<size_t, size_t>>{{0, 3}, {10, 1}, {200, 150}, {300, 70}, {400, 300}}) {
+        const CoefficientForm quotient = CoefficientForm::random(degree_q, rng);
+        const CoefficientForm divisor = CoefficientForm::random(degree_b, rng);
+        const CoefficientForm remainder = CoefficientForm::random(degree_b - 1, rng);
+        const CoefficientForm dividend = quotient * divisor + remainder;
+
+        const auto [q, r] = dividend.divide_with_remainder(divisor);
+        EXPECT_EQ(q, quotient);
+        EXPECT_EQ(r, remainder);
+
+        const auto [q_newton, r_newton] = kzg::polynomial::newton_divide(dividend.get_coefficients(),
+                                                                         divisor.get_coefficients());
+        EXPECT_EQ(CoefficientForm{q_newton}, quotient);
+        EXPECT_EQ(CoefficientForm{r_newton}, remainder);
+    }
+    EXPECT_THROW(CoefficientForm::random(5, rng).divide_with_remainder(CoefficientForm::zero()),
+                 kzg::exception::Exception);
+}
+
+TEST(Coefficient, InverseSeries) {
+    rng::impl::OsRng rng;
+    for (const auto &[size, precision]: std::vector<std::pair<size_t, size_t>>{{1, 1}, {5, 9}, {300, 257}, {40, 600}}) {
+        const CoefficientForm f = CoefficientForm::random(size - 1, rng);
+        const auto inverse = kzg::polynomial::inverse_series(f.get_coefficients(), precision);
+        ASSERT_EQ(inverse.size(), precision);
+
+        auto product = kzg::polynomial::multiply(f.get_coefficients(), inverse);
+        product.resize(precision, Scalar::zero());
+        EXPECT_EQ(product[0], Scalar::one());
+        for (size_t i = 1; i < precision; ++i)
+            EXPECT_EQ(product[i], Scalar::zero());
+    }
+}
+
+TEST(Coefficient, SubproductTree) {
+    // with more threads than the nodes of the top levels, both the level-parallel and the node-serial paths run.
+    const kzg::util::parallel::ScopedNumThreads threads{4};
+    rng::impl::OsRng rng;
+    for (const size_t count: {1, 5, 64, 300}) {
+        std::vector<Scalar> points;
+        for (size_t i = 0; i < count; ++i) points.push_back(Scalar::random(rng));
+        const kzg::polynomial::SubproductTree tree{points};
+
+        for (const size_t degree: {count - 1, count + 40}) {
+            const CoefficientForm polynomial = CoefficientForm::random(degree, rng);
+            const auto evaluations = tree.evaluate(polynomial);
+            ASSERT_EQ(evaluations.size(), count);
+            for (size_t i = 0; i < count; ++i) EXPECT_EQ(evaluations[i], polynomial.evaluate(points[i]));
+        }
+
+        const CoefficientForm polynomial = CoefficientForm::random(count - 1, rng);
+        EXPECT_EQ(tree.interpolate(tree.evaluate(polynomial)), polynomial);
+        for (const auto &point: points) EXPECT_TRUE(tree.get_root().evaluate(point).is_zero());
+    }
+    const kzg::polynomial::SubproductTree duplicated{{Scalar{1}, Scalar{2}, Scalar{1}}};
+    EXPECT_THROW(static_cast<void>(duplicated.interpolate({Scalar{1}, Scalar{2}, Scalar{3}})), kzg::exception::Exception);
+}
+
+TEST(Coefficient, Expression) {
+    using kzg::polynomial::lazy;
+    rng::impl::OsRng rng;
+    for (const size_t degree: {0, 20, 5000}) {
+        const CoefficientForm a = CoefficientForm::random(degree, rng);
+        const CoefficientForm b = CoefficientForm::random(degree / 2, rng);
+        const CoefficientForm c = CoefficientForm::random(degree + 3, rng);
+        const Scalar alpha = Scalar::random(rng);
+        const Scalar beta = Scalar::random(rng);
+
+        const CoefficientForm fused = kzg::polynomial::evaluate(lazy(a) * alpha + beta * lazy(b) - lazy(c));
+        EXPECT_EQ(fused, a * alpha + b * beta - c);
+        EXPECT_EQ(kzg::polynomial::evaluate(-lazy(a) + lazy(a)), CoefficientForm::zero());
+    }
+}
+
+TEST(Coefficient, Sparse) {
+    using kzg::polynomial::SparseCoefficientForm;
+    rng::impl::OsRng rng;
+    const auto vanishing = SparseCoefficientForm::vanishing_polynomial(16);
+    const SparseCoefficientForm selector{{{3, Scalar::random(rng)}, {40, Scalar::random(rng)}, {3, Scalar::one()}}};
+    const auto dense = CoefficientForm::random(30, rng);
+
+    EXPECT_EQ(SparseCoefficientForm::from_dense(vanishing.to_dense()), vanishing);
+    EXPECT_EQ(selector.get_terms().size(), 2);
+    EXPECT_EQ(vanishing * dense, vanishing.to_dense() * dense);
+    EXPECT_EQ(dense * selector, dense * selector.to_dense());
+    EXPECT_EQ(dense + selector, dense + selector.to_dense());
+    EXPECT_EQ(selector - dense, selector.to_dense() - dense);
+    EXPECT_EQ((vanishing * selector).to_dense(), vanishing.to_dense() * selector.to_dense());
+    EXPECT_EQ((vanishing - vanishing).is_zero(), true);
+
+    const Scalar point = Scalar::random(rng);
+    EXPECT_EQ(selector.evaluate(point), selector.to_dense().evaluate(point));
+    EXPECT_EQ(selector.ruffini(point), selector.to_dense().ruffini(point));
+
+    const auto [quotient, remainder] = vanishing.divide(dense);
+    EXPECT_EQ(quotient * vanishing.to_dense() + remainder, dense);
+    EXPECT_LT(remainder.degree(), 16);
+    const auto [exact, zero] = vanishing.divide(vanishing * dense);
+    EXPECT_EQ(exact, dense);
+    EXPECT_TRUE(zero.is_zero());
+    EXPECT_THROW(static_cast<void>(SparseCoefficientForm::zero().divide(dense)), kzg::exception::Exception);
+}
@@ -2,7 +2,9 @@
 
 #include "impl/os_rng.h"
 #include "scalar/scalar.h"
+#include "exception/exception.h"
 #include "polynomial/evaluation.h"
+#include "polynomial/expression.h"
 #include "domain/domain.h"
 
 using bls12_381::scalar::Scalar;
@@ -22,4 +24,92 @@ TEST(Evaluation, Serialization) {
     const auto poly_bytes = poly.to_var_bytes();
     const EvaluationForm poly_decoded = EvaluationForm::from_slice(poly_bytes).value();
     EXPECT_EQ(poly, poly_decoded);
-}
\ No newline at end of file
+}
+
+TEST(Evaluation, Barycentric) {
+    rng::impl::OsRng rng;
+    for (const uint64_t size: {8, 12, 4096}) {
+        const auto domain = EvaluationDomain::mixed_radix(size);
+        const auto coefficients = kzg::polynomial::CoefficientForm::random(size - 1, rng);
+        auto evals = coefficients.get_coefficients();
+        domain.fast_fourier_in_place(evals);
+        const EvaluationForm poly{evals, domain};
+
+        const std::vector<Scalar> points = {Scalar::random(rng), Scalar::random(rng), domain.group_generator()};
+        const auto results = poly.evaluate(points);
+        for (size_t i = 0; i < points.size(); ++i) {
+            EXPECT_EQ(results[i], coefficients.evaluate(points[i]));
+            EXPECT_EQ(poly.evaluate(points[i]), results[i]);
+        }
+    }
+}
+
+TEST(Evaluation, Expression) {
+    using kzg::polynomial::lazy;
+    rng::impl::OsRng rng;
+    const EvaluationDomain domain{16};
+    std::vector<Scalar> evals_a, evals_b;
+    for (int i = 0; i < 16; ++i) {
+        evals_a.push_back(Scalar::random(rng));
+        evals_b.push_back(Scalar::random(rng));
+    }
+    const EvaluationForm a{evals_a, domain};
+    const EvaluationForm b{evals_b, domain};
+    const Scalar alpha = Scalar::random(rng);
+
+    const EvaluationForm fused = kzg::polynomial::evaluate(lazy(a) - alpha * lazy(b));
+    auto expected = b;
+    for (int i = 0; i < 16; ++i) expected[i] *= alpha;
+    EXPECT_EQ(fused, a - expected);
+}
+
+TEST(Evaluation, Division) {
+    rng::impl::OsRng rng;
+    const EvaluationDomain domain{4096};
+    std::vector<Scalar> evals_a, evals_b;
+    for (int i = 0; i < 4096; ++i) {
+        evals_a.push_back(Scalar::random(rng));
+        evals_b.push_back(Scalar::random(rng));
+    }
+    const EvaluationForm a{evals_a, domain};
+    EvaluationForm b{evals_b, domain};
+    EXPECT_EQ(a * b / b, a);
+
+    b[100] = Scalar::zero();
+    EXPECT_THROW(a / b, kzg::exception::Exception);
+}
+
+TEST(Evaluation, DegreeTracking) {
+    using kzg::polynomial::CoefficientForm;
+    rng::impl::OsRng rng;
+    const auto a = CoefficientForm::random(7, rng);
+    const auto b = CoefficientForm::random(9, rng);
+    const auto a_evals = EvaluationForm::from_coefficients(a, EvaluationDomain{8});
+    const auto b_evals = EvaluationForm::from_coefficients(b, EvaluationDomain{16});
+
+    const auto sum = a_evals + b_evals;
+    EXPECT_EQ(sum.get_domain().size(), 16);
+    EXPECT_EQ(sum.get_degree_bound(), 9);
+    EXPECT_EQ(sum.interpolate(), a + b);
+
+    // the product of degree 23 does not fit in 16 evaluations, and is extended to 32.
+    const auto product = a_evals * b_evals * a_evals;
+    EXPECT_EQ(product.get_domain().size(), 32);
+    EXPECT_EQ(product.get_degree_bound(), 23);
+    EXPECT_EQ(product.interpolate(), a * b * a);
+
+    const auto mixed = EvaluationForm::from_coefficients(a, EvaluationDomain::mixed_radix(12));
+    const auto square = mixed * mixed;
+    EXPECT_EQ(square.get_domain(), EvaluationDomain::mixed_radix(24));
+    EXPECT_EQ(square.interpolate(), a * a);
+
+    EXPECT_EQ(a_evals.extend(4).interpolate(), a);
+    EXPECT_EQ(a_evals.extend(1), a_evals);
+    EXPECT_EQ(a_evals.extend(1).get_degree_bound(), 7);
+    EXPECT_THROW(static_cast<void>(a_evals.extend(3)), kzg::exception::Exception);
+
+    // the degree bound is not serialized.
+    const auto decoded = EvaluationForm::from_slice(a_evals.to_var_bytes()).value();
+    EXPECT_EQ(decoded, a_evals);
+    EXPECT_FALSE(decoded.get_degree_bound().has_value());
+}
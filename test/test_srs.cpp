@@ -2,6 +2,7 @@
 
 #include "impl/os_rng.h"
 
+#include "exception/exception.h"
 #include "structure/reference_string.h"
 
 using kzg::structure::ReferenceString;
@@ -24,4 +25,32 @@ TEST(ReferenceString, Serialize2) {
     const auto bytes_2 = pp_p->to_var_bytes();
 
     EXPECT_EQ(bytes, bytes_2);
-}
\ No newline at end of file
+}
+
+TEST(ReferenceString, VerifyStructure) {
+    rng::impl::OsRng rng{};
+    const ReferenceString pp = ReferenceString::setup(1 << 7, rng);
+    EXPECT_TRUE(pp.verify_structure(rng));
+
+    auto bytes = pp.to_var_bytes();
+    const auto swap_offset = kzg::structure::OpeningKey::BYTE_SIZE + 3 * bls12_381::group::G1Affine::BYTE_SIZE;
+    std::swap_ranges(bytes.begin() + swap_offset,
+                     bytes.begin() + swap_offset + bls12_381::group::G1Affine::BYTE_SIZE,
+                     bytes.begin() + swap_offset + bls12_381::group::G1Affine::BYTE_SIZE);
+    const auto tampered = ReferenceString::from_slice(bytes);
+    EXPECT_FALSE(tampered->verify_structure(rng));
+}
+
+TEST(ReferenceString, WriteIntoBuffer) {
+    rng::impl::OsRng rng{};
+    const ReferenceString pp = ReferenceString::setup(1 << 5, rng);
+
+    std::vector<uint8_t> buffer(pp.var_bytes_size() + 16, 0);
+    pp.write_var_bytes(buffer);
+    const std::span<const uint8_t> view{buffer.data(), pp.var_bytes_size()};
+    const auto pp_p = ReferenceString::from_slice(view);
+    EXPECT_EQ(pp.to_var_bytes(), pp_p->to_var_bytes());
+
+    std::vector<uint8_t> small(pp.var_bytes_size() - 1);
+    EXPECT_THROW(pp.write_var_bytes(small), kzg::exception::Exception);
+}
@@ -1,6 +1,14 @@
 #include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
 #include <vector>
 
+#include "impl/os_rng.h"
+#include "utils/field.h"
+#include "utils/parallel.h"
+#include "utils/workspace.h"
+
 TEST(Util, ZipSkip) {
     std::vector<uint64_t> a = {1, 2, 3, 4, 5, 6, 7, 8};
     std::vector<uint64_t> b = {1, 3, 5, 6};
@@ -16,4 +24,85 @@ TEST(Util, ZipSkip) {
     }
     for (unsigned long long i : a) std::cout << i << " ";
     std::cout << std::endl;
-}
\ No newline at end of file
+}
+
+TEST(Util, Workspace) {
+    namespace workspace = kzg::util::workspace;
+    workspace::clear();
+
+    auto buffer = workspace::acquire(64);
+    const auto *storage = buffer.data();
+    workspace::recycle(std::move(buffer));
+    EXPECT_EQ(workspace::pooled_buffers(), 1);
+
+    {
+        // a smaller request reuses the pooled storage, zeroed.
+        const workspace::ScratchBuffer scratch{16};
+        EXPECT_EQ(scratch->data(), storage);
+        EXPECT_EQ(scratch->size(), 16);
+        EXPECT_EQ(workspace::pooled_buffers(), 0);
+    }
+    EXPECT_EQ(workspace::pooled_buffers(), 1);
+
+    workspace::ScratchBuffer taken{32};
+    const auto owned = taken.take();
+    EXPECT_EQ(owned.data(), storage);
+    EXPECT_EQ(workspace::pooled_buffers(), 0);
+
+    // the uninitialized variant reuses the storage without zeroing the elements it keeps.
+    std::vector<bls12_381::scalar::Scalar> ones(8, bls12_381::scalar::Scalar::one());
+    const auto *ones_storage = ones.data();
+    workspace::recycle(std::move(ones));
+    EXPECT_EQ(workspace::pooled_bytes(), 8 * sizeof(bls12_381::scalar::Scalar));
+    const auto reused = workspace::acquire_uninitialized(4);
+    EXPECT_EQ(reused.data(), ones_storage);
+    EXPECT_EQ(reused[3], bls12_381::scalar::Scalar::one());
+    EXPECT_EQ(workspace::pooled_bytes(), 0);
+
+    // a buffer past the byte cap is freed instead of pooled.
+    workspace::recycle(std::vector<bls12_381::scalar::Scalar>(
+            workspace::MAX_POOLED_BYTES / sizeof(bls12_381::scalar::Scalar) + 1));
+    EXPECT_EQ(workspace::pooled_buffers(), 0);
+    workspace::clear();
+}
+
+TEST(Util, BatchInversion) {
+    using bls12_381::scalar::Scalar;
+    rng::impl::OsRng rng;
+    const kzg::util::parallel::ScopedNumThreads threads{4};
+    for (const size_t size: {size_t{1}, size_t{7}, 3 * kzg::util::field::BATCH_INVERSION_CHUNK_SIZE + 5}) {
+        std::vector<Scalar> scalars;
+        for (size_t i = 0; i < size; ++i)
+            scalars.push_back(i % 5 == 3 ? Scalar::zero() : Scalar::random(rng));
+        auto inverses = scalars;
+        kzg::util::field::batch_inversion(inverses);
+        for (size_t i = 0; i < size; ++i) {
+            if (scalars[i].is_zero())
+                EXPECT_TRUE(inverses[i].is_zero());
+            else
+                EXPECT_EQ(inverses[i] * scalars[i], Scalar::one());
+        }
+    }
+}
+
+TEST(Util, ParallelFor) {
+    namespace parallel = kzg::util::parallel;
+    const parallel::ScopedNumThreads threads{4};
+    std::atomic<size_t> sum{0};
+    std::atomic<bool> nested_inline{true};
+    parallel::parallel_for(1000, [&](size_t begin, size_t end) {
+        // a nested loop runs inline in the chunk instead of spawning more threads.
+        parallel::parallel_for(10, [&](size_t nested_begin, size_t nested_end) {
+            if (nested_begin != 0 || nested_end != 10) nested_inline = false;
+        });
+        for (size_t i = begin; i < end; ++i) sum += i;
+    });
+    EXPECT_EQ(sum, 999 * 1000 / 2);
+    EXPECT_TRUE(nested_inline);
+    EXPECT_FALSE(parallel::in_parallel_region());
+
+    const auto failing = [](size_t begin, size_t) {
+        if (begin != 0) throw std::runtime_error{"chunk failed"};
+    };
+    EXPECT_THROW(parallel::parallel_for(64, failing), std::runtime_error);
+}